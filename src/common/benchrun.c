@@ -0,0 +1,111 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "include/benchrun.h"
+
+/* What the child reports back through the pipe. */
+typedef struct {
+  double ms;
+  long peakKb;
+} BenchResult;
+
+/*
+ * Resets the peak resident set of this process to its current size (Linux
+ * `clear_refs`); a fresh child would otherwise start from the peak of its
+ * parent. Returns 0 on success.
+ */
+static int resetPeakRss(void) {
+  FILE *f = fopen("/proc/self/clear_refs", "w");
+  if (!f)
+    return -1;
+  int ok = fputs("5", f) >= 0;
+  return fclose(f) == 0 && ok ? 0 : -1;
+}
+
+/* Peak resident set in KiB: `VmHWM`, else the `getrusage` high-water mark. */
+static long peakRssKb(void) {
+  FILE *f = fopen("/proc/self/status", "r");
+  char line[256];
+  long kb = -1;
+  while (f && fgets(line, sizeof(line), f)) {
+    if (sscanf(line, "VmHWM: %ld", &kb) == 1)
+      break;
+  }
+  if (f)
+    fclose(f);
+  if (kb >= 0)
+    return kb;
+
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_maxrss;
+}
+
+void benchCsvHeader(FILE *out) {
+  fprintf(out, "lab,algorithm,generator,vertices,edges,ms,edges_per_s,"
+               "peak_kb\n");
+  fflush(out);
+}
+
+int benchRun(FILE *out, const BenchCase *bc, void (*run)(void *ctx),
+             void *ctx) {
+  if (!out || !bc || !run)
+    return -1;
+
+  int fd[2];
+  if (pipe(fd) < 0) {
+    fprintf(stderr, "Error: Unable to create benchmark pipe.\n");
+    return -1;
+  }
+
+  // Buffered output would otherwise be written by both processes
+  fflush(NULL);
+  pid_t pid = fork();
+  if (pid < 0) {
+    fprintf(stderr, "Error: Unable to fork benchmark process.\n");
+    close(fd[0]);
+    close(fd[1]);
+    return -1;
+  }
+
+  if (pid == 0) {
+    close(fd[0]);
+    resetPeakRss();
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    run(ctx);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    BenchResult res = {(t1.tv_sec - t0.tv_sec) * 1e3 +
+                           (t1.tv_nsec - t0.tv_nsec) / 1e6,
+                       peakRssKb()};
+    int ok = write(fd[1], &res, sizeof(res)) == (ssize_t)sizeof(res);
+    close(fd[1]);
+    _exit(ok ? 0 : 1);
+  }
+
+  close(fd[1]);
+  BenchResult res;
+  int got = read(fd[0], &res, sizeof(res)) == (ssize_t)sizeof(res);
+  close(fd[0]);
+
+  int status;
+  waitpid(pid, &status, 0);
+  if (!got || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    fprintf(stderr, "Error: Benchmark %s/%s on %s (V = %d) failed.\n", bc->lab,
+            bc->algorithm, bc->generator, bc->nn);
+    return -1;
+  }
+
+  fprintf(out, "%s,%s,%s,%d,%ld,%.3f,%.0f,%ld\n", bc->lab, bc->algorithm,
+          bc->generator, bc->nn, bc->ne, res.ms,
+          res.ms > 0 ? bc->ne / (res.ms / 1e3) : 0, res.peakKb);
+  fflush(out);
+  return 0;
+}
@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/csr.h"
+
+CsrGraph *buildCsr(const EdgeList *el) {
+  if (!el)
+    return NULL;
+
+  CsrGraph *g = (CsrGraph *)calloc(1, sizeof(CsrGraph));
+  if (!g) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR graph.\n");
+    return NULL;
+  }
+
+  g->nn = el->nn;
+  g->directed = el->directed;
+  g->na = el->directed ? el->ne : 2 * el->ne;
+  g->off = (long *)calloc((size_t)el->nn + 1, sizeof(long));
+  g->adj = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  if (el->weighted)
+    g->cost = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+
+  if (!g->off || !g->adj || (el->weighted && !g->cost)) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR arrays.\n");
+    freeCsr(g);
+    return NULL;
+  }
+
+  // Count out-degrees, shifted by one so the prefix sum yields row starts
+  for (long i = 0; i < el->ne; i++) {
+    g->off[el->src[i] + 1]++;
+    if (!el->directed)
+      g->off[el->dst[i] + 1]++;
+  }
+  for (int u = 0; u < g->nn; u++)
+    g->off[u + 1] += g->off[u];
+
+  long *pos = (long *)malloc(((size_t)g->nn + 1) * sizeof(long));
+  if (!pos) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR cursor.\n");
+    freeCsr(g);
+    return NULL;
+  }
+  for (int u = 0; u <= g->nn; u++)
+    pos[u] = g->off[u];
+
+  for (long i = 0; i < el->ne; i++) {
+    int u = el->src[i], v = el->dst[i];
+    long k = pos[u]++;
+    g->adj[k] = v;
+    if (g->cost)
+      g->cost[k] = el->cost[i];
+
+    if (!el->directed) {
+      k = pos[v]++;
+      g->adj[k] = u;
+      if (g->cost)
+        g->cost[k] = el->cost[i];
+    }
+  }
+
+  free(pos);
+  return g;
+}
+
+CsrGraph *transposeCsr(const CsrGraph *g) {
+  if (!g)
+    return NULL;
+
+  CsrGraph *t = (CsrGraph *)calloc(1, sizeof(CsrGraph));
+  if (!t) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR graph.\n");
+    return NULL;
+  }
+
+  t->nn = g->nn;
+  t->directed = g->directed;
+  t->na = g->na;
+  t->off = (long *)calloc((size_t)g->nn + 1, sizeof(long));
+  t->adj = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  if (g->cost)
+    t->cost = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  long *pos = (long *)malloc(((size_t)g->nn + 1) * sizeof(long));
+
+  if (!t->off || !t->adj || (g->cost && !t->cost) || !pos) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR arrays.\n");
+    free(pos);
+    freeCsr(t);
+    return NULL;
+  }
+
+  // Same counting sort as buildCsr, keyed by target
+  for (long k = 0; k < g->na; k++)
+    t->off[g->adj[k] + 1]++;
+  for (int v = 0; v < t->nn; v++)
+    t->off[v + 1] += t->off[v];
+  for (int v = 0; v <= t->nn; v++)
+    pos[v] = t->off[v];
+
+  for (int u = 0; u < g->nn; u++) {
+    for (long k = g->off[u]; k < g->off[u + 1]; k++) {
+      long j = pos[g->adj[k]]++;
+      t->adj[j] = u;
+      if (t->cost)
+        t->cost[j] = g->cost[k];
+    }
+  }
+
+  free(pos);
+  return t;
+}
+
+void freeCsr(CsrGraph *g) {
+  if (!g)
+    return;
+  free(g->off);
+  free(g->adj);
+  free(g->cost);
+  free(g);
+}
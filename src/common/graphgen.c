@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "include/graphgen.h"
+
+static const char *kindNames[] = {"er", "rmat", "grid", "dag"};
+
+// ---------------------- Random Numbers ----------------------
+/* xorshift64, `*state` must be non-zero. */
+static unsigned long long nextRandom(unsigned long long *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+static int randomBelow(unsigned long long *state, int n) {
+  return (int)((nextRandom(state) >> 11) % (unsigned long long)n);
+}
+
+static double randomUnit(unsigned long long *state) {
+  return (nextRandom(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/* Fisher-Yates shuffle of 0 .. n - 1; NULL if memory allocation fails. */
+static int *randomPermutation(unsigned long long *state, int n) {
+  int *perm = (int *)malloc((n > 0 ? (size_t)n : 1) * sizeof(int));
+  if (!perm) {
+    fprintf(stderr, "Error: Memory allocation failed for permutation.\n");
+    return NULL;
+  }
+  for (int i = 0; i < n; i++)
+    perm[i] = i;
+  for (int i = n - 1; i > 0; i--) {
+    int j = randomBelow(state, i + 1), tmp = perm[i];
+    perm[i] = perm[j];
+    perm[j] = tmp;
+  }
+  return perm;
+}
+
+// ---------------------- Families ----------------------
+static void fillErdosRenyi(EdgeList *el, unsigned long long *state) {
+  for (long i = 0; i < el->ne; i++) {
+    int u, v;
+    do {
+      u = randomBelow(state, el->nn);
+      v = randomBelow(state, el->nn);
+    } while (u == v);
+    el->src[i] = u;
+    el->dst[i] = v;
+  }
+}
+
+static int fillRmat(EdgeList *el, unsigned long long *state) {
+  int scale = 0;
+  while ((1L << scale) < el->nn)
+    scale++;
+
+  // Relabel so the heavy vertices are not all clustered at the low ids
+  int *perm = randomPermutation(state, el->nn);
+  if (!perm)
+    return -1;
+
+  for (long i = 0; i < el->ne; i++) {
+    long u, v;
+    do {
+      u = v = 0;
+      for (int bit = 0; bit < scale; bit++) {
+        double r = randomUnit(state);
+        // Quadrants a = (0, 0), b = (0, 1), c = (1, 0), d = (1, 1)
+        int down = r >= RMAT_A + RMAT_B;
+        int right = r >= RMAT_A &&
+                    (r < RMAT_A + RMAT_B || r >= RMAT_A + RMAT_B + RMAT_C);
+        u = (u << 1) | down;
+        v = (v << 1) | right;
+      }
+    } while (u >= el->nn || v >= el->nn || u == v);
+    el->src[i] = perm[u];
+    el->dst[i] = perm[v];
+  }
+
+  free(perm);
+  return 0;
+}
+
+static void fillGrid(EdgeList *el, int rows, int cols) {
+  long k = 0;
+  for (int r = 0; r < rows; r++) {
+    for (int c = 0; c < cols; c++) {
+      int u = r * cols + c;
+      int next[2] = {c + 1 < cols ? u + 1 : -1, r + 1 < rows ? u + cols : -1};
+      for (int j = 0; j < 2; j++) {
+        if (next[j] < 0)
+          continue;
+        el->src[k] = u;
+        el->dst[k++] = next[j];
+        if (el->directed) {
+          el->src[k] = next[j];
+          el->dst[k++] = u;
+        }
+      }
+    }
+  }
+}
+
+static int fillDag(EdgeList *el, unsigned long long *state) {
+  int *order = randomPermutation(state, el->nn);
+  if (!order)
+    return -1;
+
+  for (long i = 0; i < el->ne; i++) {
+    int a, b;
+    do {
+      a = randomBelow(state, el->nn);
+      b = randomBelow(state, el->nn);
+    } while (a == b);
+    el->src[i] = order[a < b ? a : b];
+    el->dst[i] = order[a < b ? b : a];
+  }
+
+  free(order);
+  return 0;
+}
+
+// ---------------------- Generate ----------------------
+EdgeList *generateGraph(GraphGenKind kind, int nn, long ne, int directed,
+                        int maxCost, unsigned long long seed) {
+  if (nn <= 0 || ne < 0 || seed == 0 || kind < GRAPHGEN_ERDOS_RENYI ||
+      kind > GRAPHGEN_DAG) {
+    fprintf(stderr, "Error: Invalid graph generator parameters.\n");
+    return NULL;
+  }
+  if (kind != GRAPHGEN_GRID && ne > 0 && nn < 2) {
+    fprintf(stderr, "Error: A graph without self loops needs two vertices.\n");
+    return NULL;
+  }
+
+  int rows = 1, cols = nn;
+  if (kind == GRAPHGEN_GRID) {
+    while ((long)(rows + 1) * (rows + 1) <= nn)
+      rows++;
+    cols = nn / rows;
+    nn = rows * cols;
+    ne = (long)rows * (cols - 1) + (long)(rows - 1) * cols;
+    if (directed)
+      ne *= 2;
+  }
+  if (kind == GRAPHGEN_DAG)
+    directed = 1;
+
+  EdgeList *el = createEdgeList(nn, ne, directed, maxCost > 0);
+  if (!el)
+    return NULL;
+
+  unsigned long long state = seed;
+  int status = 0;
+  switch (kind) {
+  case GRAPHGEN_ERDOS_RENYI:
+    fillErdosRenyi(el, &state);
+    break;
+  case GRAPHGEN_RMAT:
+    status = fillRmat(el, &state);
+    break;
+  case GRAPHGEN_GRID:
+    fillGrid(el, rows, cols);
+    break;
+  case GRAPHGEN_DAG:
+    status = fillDag(el, &state);
+    break;
+  }
+  if (status != 0) {
+    freeEdgeList(el);
+    return NULL;
+  }
+
+  for (long i = 0; el->weighted && i < el->ne; i++)
+    el->cost[i] = 1 + randomBelow(&state, maxCost);
+
+  return el;
+}
+
+int parseGraphGenKind(const char *name) {
+  for (int k = 0; name && k <= GRAPHGEN_DAG; k++) {
+    if (strcmp(name, kindNames[k]) == 0)
+      return k;
+  }
+  return -1;
+}
+
+const char *graphGenName(GraphGenKind kind) {
+  return kind >= GRAPHGEN_ERDOS_RENYI && kind <= GRAPHGEN_DAG ? kindNames[kind]
+                                                              : "unknown";
+}
@@ -0,0 +1,313 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "include/graphio.h"
+
+#define GRAPHIO_MAGIC "SDAGRAPH"
+#define GRAPHIO_VERSION 1
+
+/* On-disk header of the binary format, 32 bytes. */
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  int32_t nn;
+  int32_t directed;
+  int32_t weighted;
+  int64_t ne;
+} GraphFileHeader;
+
+// ---------------------- Create / Free ----------------------
+EdgeList *createEdgeList(int nn, long ne, int directed, int weighted) {
+  if (nn < 0 || ne < 0)
+    return NULL;
+
+  EdgeList *el = (EdgeList *)calloc(1, sizeof(EdgeList));
+  if (!el) {
+    fprintf(stderr, "Error: Memory allocation failed for edge list.\n");
+    return NULL;
+  }
+
+  el->nn = nn;
+  el->ne = ne;
+  el->directed = directed;
+  el->weighted = weighted;
+
+  size_t n = ne > 0 ? (size_t)ne : 1;
+  el->src = (int *)malloc(n * sizeof(int));
+  el->dst = (int *)malloc(n * sizeof(int));
+  if (weighted)
+    el->cost = (int *)malloc(n * sizeof(int));
+
+  if (!el->src || !el->dst || (weighted && !el->cost)) {
+    fprintf(stderr, "Error: Memory allocation failed for edge arrays.\n");
+    freeEdgeList(el);
+    return NULL;
+  }
+
+  return el;
+}
+
+void freeEdgeList(EdgeList *el) {
+  if (!el)
+    return;
+
+  if (el->map) {
+    munmap(el->map, el->mapLen);
+  } else {
+    free(el->src);
+    free(el->dst);
+    free(el->cost);
+  }
+  free(el);
+}
+
+// ---------------------- Text Parsing ----------------------
+/*
+ * Scans the next (optionally negative) integer; returns 0 at end of input.
+ * Values too large for a long saturate at +-LONG_MAX.
+ */
+static int nextInt(const char **it, const char *end, long *out) {
+  const char *p = *it;
+
+  while (p < end && !(*p >= '0' && *p <= '9') && *p != '-')
+    p++;
+  if (p == end)
+    return 0;
+
+  int neg = 0;
+  if (*p == '-') {
+    neg = 1;
+    p++;
+  }
+
+  long val = 0;
+  int digits = 0;
+  while (p < end && *p >= '0' && *p <= '9') {
+    val = val <= (LONG_MAX - 9) / 10 ? val * 10 + (*p - '0') : LONG_MAX;
+    p++;
+    digits++;
+  }
+
+  *it = p;
+  if (!digits)
+    return nextInt(it, end, out); // lone '-', keep scanning
+
+  *out = neg ? -val : val;
+  return 1;
+}
+
+EdgeList *parseEdgeListText(const char *buf, size_t len, GraphTextFormat fmt) {
+  if (!buf)
+    return NULL;
+
+  const char *it = buf, *end = buf + len;
+  long nn, ne, type = 0;
+
+  if (!nextInt(&it, end, &nn) ||
+      (fmt == GRAPHIO_TYPED && !nextInt(&it, end, &type)) ||
+      !nextInt(&it, end, &ne) || nn < 0 || nn > INT_MAX || type < INT_MIN ||
+      type > INT_MAX) {
+    fprintf(stderr, "Error reading graph dimensions.\n");
+    return NULL;
+  }
+
+  int weighted = fmt != GRAPHIO_PLAIN;
+  EdgeList *el = createEdgeList((int)nn, ne, (int)type, weighted);
+  if (!el)
+    return NULL;
+
+  for (long i = 0; i < ne; i++) {
+    long u, v, c = 0;
+    if (!nextInt(&it, end, &u) || !nextInt(&it, end, &v) ||
+        (weighted && !nextInt(&it, end, &c))) {
+      fprintf(stderr, "Error reading edges.\n");
+      freeEdgeList(el);
+      return NULL;
+    }
+    if (u < 0 || v < 0 || u >= nn || v >= nn) {
+      fprintf(stderr, "Error: Invalid edge (%ld, %ld).\n", u, v);
+      freeEdgeList(el);
+      return NULL;
+    }
+    if (c < INT_MIN || c > INT_MAX) {
+      fprintf(stderr, "Error: Invalid cost %ld.\n", c);
+      freeEdgeList(el);
+      return NULL;
+    }
+
+    el->src[i] = (int)u;
+    el->dst[i] = (int)v;
+    if (weighted)
+      el->cost[i] = (int)c;
+  }
+
+  return el;
+}
+
+// ---------------------- Binary Format ----------------------
+static int validHeader(const GraphFileHeader *h, size_t fileLen) {
+  if (memcmp(h->magic, GRAPHIO_MAGIC, sizeof(h->magic)) != 0 ||
+      h->version != GRAPHIO_VERSION || h->nn < 0 || h->ne < 0)
+    return 0;
+
+  // Reject counts whose array size does not fit in size_t
+  size_t arrays = h->weighted ? 3 : 2;
+  if ((uint64_t)h->ne > SIZE_MAX / (arrays * sizeof(int32_t)))
+    return 0;
+  return fileLen == sizeof(GraphFileHeader) + arrays * h->ne * sizeof(int32_t);
+}
+
+/* Every endpoint must name a vertex, as the text parser requires. */
+static int validEndpoints(const int32_t *src, const int32_t *dst, int64_t ne,
+                          int32_t nn) {
+  for (int64_t i = 0; i < ne; i++) {
+    if (src[i] < 0 || src[i] >= nn || dst[i] < 0 || dst[i] >= nn)
+      return 0;
+  }
+  return 1;
+}
+
+EdgeList *mapEdgeListBinary(const char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "Error: Unable to open graph file: %s\n", path);
+    return NULL;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(GraphFileHeader)) {
+    close(fd);
+    return NULL;
+  }
+
+  size_t len = (size_t)st.st_size;
+  void *map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    fprintf(stderr, "Error: Unable to map graph file: %s\n", path);
+    return NULL;
+  }
+
+  GraphFileHeader *h = (GraphFileHeader *)map;
+  if (!validHeader(h, len)) {
+    fprintf(stderr, "Error: Corrupt binary graph file: %s\n", path);
+    munmap(map, len);
+    return NULL;
+  }
+
+  int32_t *data = (int32_t *)(h + 1);
+  if (!validEndpoints(data, data + h->ne, h->ne, h->nn)) {
+    fprintf(stderr, "Error: Invalid edge endpoint in graph file: %s\n", path);
+    munmap(map, len);
+    return NULL;
+  }
+
+  EdgeList *el = (EdgeList *)calloc(1, sizeof(EdgeList));
+  if (!el) {
+    munmap(map, len);
+    return NULL;
+  }
+
+  el->nn = h->nn;
+  el->ne = (long)h->ne;
+  el->directed = h->directed;
+  el->weighted = h->weighted;
+  el->src = data;
+  el->dst = data + h->ne;
+  el->cost = h->weighted ? data + 2 * h->ne : NULL;
+  el->map = map;
+  el->mapLen = len;
+
+  return el;
+}
+
+int saveEdgeListBinary(const EdgeList *el, const char *path) {
+  if (!el || !path)
+    return -1;
+
+  FILE *out = fopen(path, "wb");
+  if (!out) {
+    fprintf(stderr, "Error: Could not open file for writing: %s\n", path);
+    return -1;
+  }
+
+  GraphFileHeader h;
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, GRAPHIO_MAGIC, sizeof(h.magic));
+  h.version = GRAPHIO_VERSION;
+  h.nn = el->nn;
+  h.directed = el->directed;
+  h.weighted = el->weighted;
+  h.ne = el->ne;
+
+  size_t ne = (size_t)el->ne;
+  int ok = fwrite(&h, sizeof(h), 1, out) == 1 &&
+           fwrite(el->src, sizeof(int), ne, out) == ne &&
+           fwrite(el->dst, sizeof(int), ne, out) == ne &&
+           (!el->weighted || fwrite(el->cost, sizeof(int), ne, out) == ne);
+
+  if (fclose(out) != 0)
+    ok = 0;
+  if (!ok)
+    fprintf(stderr, "Error: Failed writing graph file: %s\n", path);
+
+  return ok ? 0 : -1;
+}
+
+// ---------------------- Load ----------------------
+EdgeList *loadEdgeList(const char *path, GraphTextFormat fmt) {
+  if (!path)
+    return NULL;
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "Error: Unable to open graph file: %s\n", path);
+    return NULL;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) < 0) {
+    close(fd);
+    return NULL;
+  }
+
+  size_t len = (size_t)st.st_size;
+  char magic[8];
+  if (len >= sizeof(GraphFileHeader) &&
+      read(fd, magic, sizeof(magic)) == (ssize_t)sizeof(magic) &&
+      memcmp(magic, GRAPHIO_MAGIC, sizeof(magic)) == 0) {
+    close(fd);
+    EdgeList *el = mapEdgeListBinary(path);
+    if (el && fmt != GRAPHIO_PLAIN && !el->weighted) {
+      fprintf(stderr, "Error: Graph file has no edge costs: %s\n", path);
+      freeEdgeList(el);
+      return NULL;
+    }
+    return el;
+  }
+
+  if (len == 0) {
+    close(fd);
+    return parseEdgeListText("", 0, fmt);
+  }
+
+  char *text = (char *)mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (text == MAP_FAILED) {
+    fprintf(stderr, "Error: Unable to map graph file: %s\n", path);
+    return NULL;
+  }
+
+  EdgeList *el = parseEdgeListText(text, len, fmt);
+  munmap(text, len);
+  return el;
+}
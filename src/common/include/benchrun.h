@@ -0,0 +1,47 @@
+#ifndef BENCHRUN_H_
+#define BENCHRUN_H_
+
+#include <stdio.h>
+
+/**
+ * @brief One benchmark measurement, written as one CSV row.
+ *
+ * - `lab`, `algorithm`, `generator`: labels of the row.
+ * - `nn`, `ne`: size of the input graph; `ne` is also the work unit of the
+ *   `edges_per_s` column.
+ */
+typedef struct {
+  const char *lab;
+  const char *algorithm;
+  const char *generator;
+  int nn;
+  long ne;
+} BenchCase;
+
+/**
+ * @brief Writes the CSV header shared by every lab's scale benchmark:
+ * `lab,algorithm,generator,vertices,edges,ms,edges_per_s,peak_kb`.
+ *
+ * @param out Output stream.
+ */
+void benchCsvHeader(FILE *out);
+
+/**
+ * @brief Times `run(ctx)` in a forked child and writes one CSV row.
+ *
+ * Running in a child gives every measurement its own peak resident set: the
+ * high-water mark is reset when the child starts (Linux `clear_refs`, else
+ * the `getrusage` mark is used as is), so it covers the pages of the input
+ * graph the algorithm touches plus everything it allocates. Nothing the
+ * algorithm does is visible to the parent.
+ *
+ * @param out Output stream of the CSV row.
+ * @param bc Labels and size of the measurement.
+ * @param run Algorithm to time.
+ * @param ctx Argument of `run`.
+ * @return 0 on success, -1 if the child could not run or crashed.
+ */
+int benchRun(FILE *out, const BenchCase *bc, void (*run)(void *ctx),
+             void *ctx);
+
+#endif /* BENCHRUN_H_ */
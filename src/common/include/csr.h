@@ -0,0 +1,54 @@
+#ifndef CSR_H_
+#define CSR_H_
+
+#include "graphio.h"
+
+/**
+ * @brief Compressed sparse row (CSR) graph.
+ *
+ * The neighbours of vertex `u` are `adj[off[u] .. off[u + 1])`, with the
+ * matching weights in `cost` for weighted graphs. Undirected edges are stored
+ * once in each direction.
+ *
+ * This is the read-only format shared by the labs: every lab converts its own
+ * adjacency lists to it (`graphToCsr` in lab10 and lab12, `graph_to_csr` in
+ * lab11) and builds from the shared `EdgeList`, so algorithms written against
+ * `CsrGraph` run on any lab's graph.
+ */
+typedef struct {
+  int nn;       /* number of vertices */
+  int directed; /* 0 if every edge is stored in both directions */
+  long na;      /* number of stored arcs */
+  long *off;    /* nn + 1 row offsets */
+  int *adj;
+  int *cost;    /* NULL for unweighted graphs */
+} CsrGraph;
+
+/**
+ * @brief Builds a CSR graph from an edge list with a counting sort by source.
+ *
+ * Arcs of each vertex keep the order in which they appear in the edge list.
+ *
+ * @param el Edge list to convert.
+ * @return Pointer to the CSR graph, or NULL if memory allocation fails.
+ */
+CsrGraph *buildCsr(const EdgeList *el);
+
+/**
+ * @brief Builds the transpose of a CSR graph (the in-arcs of every vertex).
+ *
+ * In-arcs of each vertex are ordered by source.
+ *
+ * @param g Graph to transpose.
+ * @return Pointer to the transposed graph, or NULL if memory allocation fails.
+ */
+CsrGraph *transposeCsr(const CsrGraph *g);
+
+/**
+ * @brief Frees a CSR graph.
+ *
+ * @param g Graph to free.
+ */
+void freeCsr(CsrGraph *g);
+
+#endif /* CSR_H_ */
@@ -0,0 +1,61 @@
+#ifndef GRAPHGEN_H_
+#define GRAPHGEN_H_
+
+#include "graphio.h"
+
+/* R-MAT quadrant probabilities (Graph500); d = 1 - a - b - c. */
+#define RMAT_A 0.57
+#define RMAT_B 0.19
+#define RMAT_C 0.19
+
+/**
+ * @brief Families of synthetic graphs.
+ *
+ * - `GRAPHGEN_ERDOS_RENYI`: `ne` arcs between uniform random vertex pairs.
+ * - `GRAPHGEN_RMAT`: `ne` arcs placed by recursive quadrant choice (R-MAT /
+ *   Kronecker), giving skewed, power-law-like degrees.
+ * - `GRAPHGEN_GRID`: road-like `rows x cols` grid with 4-neighbour links,
+ *   `rows = floor(sqrt(nn))`; `ne` is ignored.
+ * - `GRAPHGEN_DAG`: `ne` arcs that all go forward in a hidden random
+ *   topological order, so the graph is acyclic; always directed.
+ */
+typedef enum {
+  GRAPHGEN_ERDOS_RENYI,
+  GRAPHGEN_RMAT,
+  GRAPHGEN_GRID,
+  GRAPHGEN_DAG
+} GraphGenKind;
+
+/**
+ * @brief Generates a random graph as an edge list.
+ *
+ * No self loops are produced; parallel arcs may appear for the random
+ * families. Costs are uniform in `[1, maxCost]`, or the list is unweighted
+ * if `maxCost <= 0`. The same seed always gives the same graph.
+ *
+ * @param kind Graph family.
+ * @param nn Number of vertices (the grid may use slightly fewer).
+ * @param ne Number of edges (ignored for the grid).
+ * @param directed 0 = undirected, 1 = directed (forced for `GRAPHGEN_DAG`).
+ * @param maxCost Largest edge cost, 0 for an unweighted list.
+ * @param seed Seed of the random generator (non-zero).
+ * @return Pointer to the edge list, or NULL on error.
+ */
+EdgeList *generateGraph(GraphGenKind kind, int nn, long ne, int directed,
+                        int maxCost, unsigned long long seed);
+
+/**
+ * @brief Parses a family name: `er`, `rmat`, `grid` or `dag`.
+ *
+ * @param name Family name.
+ * @return The family, or -1 if the name is unknown.
+ */
+int parseGraphGenKind(const char *name);
+
+/**
+ * @brief Returns the short name of a family (as accepted by
+ * `parseGraphGenKind`).
+ */
+const char *graphGenName(GraphGenKind kind);
+
+#endif /* GRAPHGEN_H_ */
@@ -0,0 +1,112 @@
+#ifndef GRAPHIO_H_
+#define GRAPHIO_H_
+
+#include <stddef.h>
+
+/**
+ * @brief Layout of a text edge-list file.
+ *
+ * All formats are whitespace separated integers:
+ * - `GRAPHIO_PLAIN`    : `V E` followed by `E` pairs `u v` (lab10).
+ * - `GRAPHIO_WEIGHTED` : `V E` followed by `E` triples `u v c` (lab11).
+ * - `GRAPHIO_TYPED`    : `V type E` followed by `E` triples `u v c` (lab12).
+ */
+typedef enum {
+  GRAPHIO_PLAIN,
+  GRAPHIO_WEIGHTED,
+  GRAPHIO_TYPED
+} GraphTextFormat;
+
+/**
+ * @brief Flat edge list, the common exchange format of the graph labs.
+ *
+ * Edges are stored as three parallel arrays (structure of arrays). When the
+ * list was loaded from a binary file the arrays point straight into a private
+ * memory mapping of that file, otherwise they are heap allocated.
+ */
+typedef struct {
+  int nn;       /* number of vertices */
+  int directed; /* 0 = undirected, 1 = directed */
+  int weighted; /* 1 if `cost` holds per-edge weights */
+  long ne;      /* number of edges */
+  int *src;
+  int *dst;
+  int *cost; /* NULL for unweighted lists */
+
+  void *map;     /* base of the file mapping, NULL if heap allocated */
+  size_t mapLen; /* length of the file mapping */
+} EdgeList;
+
+/**
+ * @brief Allocates an empty edge list with room for `ne` edges.
+ *
+ * @param nn Number of vertices.
+ * @param ne Number of edges.
+ * @param directed 0 = undirected, 1 = directed.
+ * @param weighted 1 to allocate the `cost` array.
+ * @return Pointer to the edge list, or NULL if memory allocation fails.
+ */
+EdgeList *createEdgeList(int nn, long ne, int directed, int weighted);
+
+/**
+ * @brief Parses a text edge list held in memory.
+ *
+ * Uses a hand-rolled integer scanner instead of `scanf`, so the cost is a
+ * single pass over the bytes. A vertex count above `INT_MAX`, edges with
+ * endpoints outside `[0, V)` and costs outside the `int` range are rejected.
+ *
+ * @param buf Text to parse (does not need to be NUL terminated).
+ * @param len Length of `buf` in bytes.
+ * @param fmt Layout of the text.
+ * @return Pointer to the edge list, or NULL on malformed input.
+ */
+EdgeList *parseEdgeListText(const char *buf, size_t len, GraphTextFormat fmt);
+
+/**
+ * @brief Loads an edge list from a file.
+ *
+ * Binary files written by `saveEdgeListBinary` are detected by their magic
+ * header and memory mapped; anything else is parsed as text using `fmt`.
+ * A weighted `fmt` also rejects binary files without costs, so `cost` is
+ * never NULL when the caller asked for one.
+ *
+ * @param path Path of the file.
+ * @param fmt Layout used if the file turns out to be text; weighted layouts
+ * require costs in binary files too.
+ * @return Pointer to the edge list, or NULL on error.
+ */
+EdgeList *loadEdgeList(const char *path, GraphTextFormat fmt);
+
+/**
+ * @brief Memory maps a binary edge-list file.
+ *
+ * The mapping is private, so callers may modify the arrays without touching
+ * the file.
+ *
+ * @param path Path of the binary file.
+ * @return Pointer to the edge list, or NULL if the file is not a valid
+ * binary edge list (bad header, size, or an endpoint outside `[0, nn)`).
+ */
+EdgeList *mapEdgeListBinary(const char *path);
+
+/**
+ * @brief Writes an edge list in the binary format.
+ *
+ * Layout: a 32-byte header (`"SDAGRAPH"`, version, `nn`, `directed`,
+ * `weighted`, `ne`) followed by the `src`, `dst` and, for weighted lists,
+ * `cost` arrays as native 32-bit integers.
+ *
+ * @param el Edge list to save.
+ * @param path Destination path.
+ * @return 0 on success, -1 on error.
+ */
+int saveEdgeListBinary(const EdgeList *el, const char *path);
+
+/**
+ * @brief Frees an edge list, unmapping it if it was loaded from a binary file.
+ *
+ * @param el Edge list to free.
+ */
+void freeEdgeList(EdgeList *el);
+
+#endif /* GRAPHIO_H_ */
@@ -0,0 +1,61 @@
+#ifndef PAGERANK_H_
+#define PAGERANK_H_
+
+#include "csr.h"
+
+#define PAGERANK_DAMPING 0.85
+#define PAGERANK_TOLERANCE 1e-9
+#define PAGERANK_MAX_ITER 100
+
+/**
+ * @brief Iteration controls of `pageRank` / `personalizedPageRank`.
+ *
+ * - `damping`: probability of following an arc instead of teleporting.
+ * - `tolerance`: stop once the L1 change of the rank vector drops below it.
+ * - `maxIter`: hard limit on the number of iterations.
+ */
+typedef struct {
+  double damping;
+  double tolerance;
+  int maxIter;
+} PageRankOptions;
+
+/**
+ * @brief Returns the default options (`PAGERANK_DAMPING`,
+ * `PAGERANK_TOLERANCE`, `PAGERANK_MAX_ITER`).
+ */
+PageRankOptions pageRankDefaults(void);
+
+/**
+ * @brief Computes the PageRank of every vertex.
+ *
+ * Pull-based power iteration: each vertex sums the `rank / outdeg` of its
+ * in-neighbours over the transposed graph, so every thread only writes its
+ * own vertices and the inner loop is a plain gather-and-add reduction.
+ * The mass of dangling vertices (no out-arcs) is spread uniformly.
+ * Ranks sum to 1.
+ *
+ * @param g Graph (out-arcs).
+ * @param opt Iteration controls, NULL for the defaults.
+ * @param rank Output: `g->nn` ranks.
+ * @return Number of iterations run, or -1 on error.
+ */
+int pageRank(const CsrGraph *g, const PageRankOptions *opt, double *rank);
+
+/**
+ * @brief Computes the PageRank personalized to a set of seed vertices.
+ *
+ * Same iteration as `pageRank`, but teleports (and dangling mass) only go to
+ * the seeds, uniformly. Seeds outside `[0, nn)` are rejected.
+ *
+ * @param g Graph (out-arcs).
+ * @param opt Iteration controls, NULL for the defaults.
+ * @param seeds Seed vertices.
+ * @param numSeeds Number of seeds (at least one).
+ * @param rank Output: `g->nn` ranks.
+ * @return Number of iterations run, or -1 on error.
+ */
+int personalizedPageRank(const CsrGraph *g, const PageRankOptions *opt,
+                         const int *seeds, int numSeeds, double *rank);
+
+#endif /* PAGERANK_H_ */
@@ -0,0 +1,69 @@
+#ifndef REORDER_H_
+#define REORDER_H_
+
+#include "csr.h"
+#include "graphio.h"
+
+/**
+ * @brief Vertex renumbering strategies.
+ *
+ * - `REORDER_DEGREE`: by decreasing degree, so hubs share cache lines.
+ * - `REORDER_BFS`: BFS discovery order, one component after another.
+ * - `REORDER_RCM`: Reverse Cuthill-McKee; BFS from a pseudo-peripheral
+ *   vertex, neighbours by increasing degree, reversed. Keeps the ids of
+ *   adjacent vertices close (small bandwidth).
+ */
+typedef enum { REORDER_DEGREE, REORDER_BFS, REORDER_RCM } ReorderMethod;
+
+/**
+ * @brief Computes a vertex renumbering.
+ *
+ * The BFS based methods follow the arcs stored in `g`; for undirected graphs
+ * pass a CSR holding both directions of every edge (as `buildCsr` does). On
+ * directed graphs, vertices not reached from the earlier seeds start new
+ * searches, so the result is a permutation either way.
+ *
+ * @param g Graph to renumber.
+ * @param method Strategy.
+ * @param perm Output: `perm[old] = new`, a permutation of `0 .. nn - 1`.
+ * @return 0 on success, -1 on error.
+ */
+int computeOrdering(const CsrGraph *g, ReorderMethod method, int *perm);
+
+/**
+ * @brief Inverts a permutation: `inv[perm[v]] = v`.
+ *
+ * A per-vertex result `res` computed on the renumbered graph maps back with
+ * `orig[v] = res[perm[v]]`, or `orig[inv[w]] = res[w]`.
+ *
+ * @param perm Permutation of `0 .. n - 1`.
+ * @param n Number of vertices.
+ * @param inv Output permutation.
+ */
+void invertPermutation(const int *perm, int n, int *inv);
+
+/**
+ * @brief Renumbers an edge list in place with `perm[old] = new`.
+ *
+ * Edges are also sorted (stably) by their new source, so adjacency lists
+ * built from the list by any lab are allocated in vertex order as well.
+ *
+ * @param el Edge list to renumber.
+ * @param perm Permutation of `0 .. el->nn - 1`.
+ * @return 0 on success, -1 on error.
+ */
+int permuteEdgeList(EdgeList *el, const int *perm);
+
+/**
+ * @brief Builds a renumbered copy of a CSR graph.
+ *
+ * Row `perm[u]` of the copy holds the arcs of `u`, targets renumbered, in
+ * the original order.
+ *
+ * @param g Graph to renumber.
+ * @param perm Permutation of `0 .. g->nn - 1`.
+ * @return Pointer to the new graph, or NULL if memory allocation fails.
+ */
+CsrGraph *permuteCsr(const CsrGraph *g, const int *perm);
+
+#endif /* REORDER_H_ */
@@ -0,0 +1,54 @@
+#ifndef UNIONFIND_H_
+#define UNIONFIND_H_
+
+/**
+ * @brief Disjoint-set forest with path compression and union by rank.
+ *
+ * - `parent`: parent of each element, roots point to themselves.
+ * - `rank`: upper bound of the height of each root's tree.
+ * - `sets`: current number of disjoint sets.
+ */
+typedef struct {
+  int n;
+  int sets;
+  int *parent;
+  unsigned char *rank;
+} UnionFind;
+
+/**
+ * @brief Creates `n` singleton sets `{0}, {1}, ..., {n - 1}`.
+ *
+ * @param n Number of elements.
+ * @return Pointer to the structure, or NULL if memory allocation fails.
+ */
+UnionFind *createUnionFind(int n);
+
+/**
+ * @brief Returns the representative of the set containing `x`.
+ *
+ * Every node on the path is re-linked directly to the root.
+ *
+ * @param uf Pointer to the structure.
+ * @param x Element.
+ * @return Root of the set containing `x`.
+ */
+int findSet(UnionFind *uf, int x);
+
+/**
+ * @brief Merges the sets containing `a` and `b`.
+ *
+ * @param uf Pointer to the structure.
+ * @param a First element.
+ * @param b Second element.
+ * @return 1 if two different sets were merged, 0 if already joined.
+ */
+int unionSets(UnionFind *uf, int a, int b);
+
+/**
+ * @brief Frees all memory allocated for the structure.
+ *
+ * @param uf Pointer to the structure.
+ */
+void destroyUnionFind(UnionFind *uf);
+
+#endif /* UNIONFIND_H_ */
@@ -0,0 +1,287 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "include/reorder.h"
+
+/* Pseudo-peripheral search stops after this many BFS sweeps. */
+#define RCM_SWEEPS 5
+
+typedef struct {
+  long deg;
+  int v;
+} DegreeKey;
+
+static int compareDegree(const void *a, const void *b) {
+  const DegreeKey *x = (const DegreeKey *)a, *y = (const DegreeKey *)b;
+  if (x->deg != y->deg)
+    return x->deg < y->deg ? -1 : 1;
+  return x->v - y->v;
+}
+
+static long degreeOf(const CsrGraph *g, int v) {
+  return g->off[v + 1] - g->off[v];
+}
+
+// ---------------------- Degree Sort ----------------------
+/* Counting sort by decreasing degree, ties by increasing id. */
+static int degreeOrdering(const CsrGraph *g, int *perm) {
+  long maxDeg = 0;
+  for (int v = 0; v < g->nn; v++)
+    if (degreeOf(g, v) > maxDeg)
+      maxDeg = degreeOf(g, v);
+
+  long *start = (long *)calloc((size_t)maxDeg + 2, sizeof(long));
+  if (!start) {
+    fprintf(stderr, "Error: Memory allocation failed for degree buckets.\n");
+    return -1;
+  }
+
+  // Bucket maxDeg - d holds the vertices of degree d
+  for (int v = 0; v < g->nn; v++)
+    start[maxDeg - degreeOf(g, v) + 1]++;
+  for (long d = 0; d <= maxDeg; d++)
+    start[d + 1] += start[d];
+  for (int v = 0; v < g->nn; v++)
+    perm[v] = (int)start[maxDeg - degreeOf(g, v)]++;
+
+  free(start);
+  return 0;
+}
+
+// ---------------------- BFS Order ----------------------
+/*
+ * Appends the vertices reached from `s` to `order[*count ..]`, skipping those
+ * with `perm[v] >= 0`, and marks them with 0. With `byDegree` the new
+ * neighbours of every vertex are appended by increasing degree
+ * (Cuthill-McKee), using `keys` as scratch.
+ */
+static void bfsAppend(const CsrGraph *g, int s, int byDegree, int *perm,
+                      int *order, int *count, DegreeKey *keys) {
+  int head = *count;
+  perm[s] = 0;
+  order[(*count)++] = s;
+
+  while (head < *count) {
+    int u = order[head++], found = 0;
+    for (long k = g->off[u]; k < g->off[u + 1]; k++) {
+      int v = g->adj[k];
+      if (perm[v] >= 0)
+        continue;
+      perm[v] = 0;
+      keys[found].deg = degreeOf(g, v);
+      keys[found++].v = v;
+    }
+
+    if (byDegree && found > 1)
+      qsort(keys, found, sizeof(DegreeKey), compareDegree);
+    for (int i = 0; i < found; i++)
+      order[(*count)++] = keys[i].v;
+  }
+}
+
+/*
+ * George-Liu pseudo-peripheral vertex of the unnumbered part reachable from
+ * `r`: repeatedly jump to a minimum-degree vertex of the last BFS level while
+ * the eccentricity grows. `level` must be all -1 and is left that way.
+ */
+static int pseudoPeripheral(const CsrGraph *g, int r, const int *perm,
+                            int *level, int *queue) {
+  int ecc = -1;
+  for (int sweep = 0; sweep < RCM_SWEEPS; sweep++) {
+    int head = 0, tail = 0;
+    level[r] = 0;
+    queue[tail++] = r;
+    while (head < tail) {
+      int u = queue[head++];
+      for (long k = g->off[u]; k < g->off[u + 1]; k++) {
+        int v = g->adj[k];
+        if (perm[v] < 0 && level[v] < 0) {
+          level[v] = level[u] + 1;
+          queue[tail++] = v;
+        }
+      }
+    }
+
+    int depth = level[queue[tail - 1]], best = queue[tail - 1];
+    for (int i = tail - 1; i >= 0 && level[queue[i]] == depth; i--)
+      if (degreeOf(g, queue[i]) < degreeOf(g, best))
+        best = queue[i];
+    for (int i = 0; i < tail; i++)
+      level[queue[i]] = -1;
+
+    if (depth <= ecc)
+      break;
+    ecc = depth;
+    r = best;
+  }
+  return r;
+}
+
+/* BFS (or RCM) numbering of every component, in order of the seeds. */
+static int bfsOrdering(const CsrGraph *g, int rcm, int *perm) {
+  int n = g->nn;
+  long maxDeg = 0;
+  for (int v = 0; v < n; v++)
+    if (degreeOf(g, v) > maxDeg)
+      maxDeg = degreeOf(g, v);
+
+  int *order = (int *)malloc((size_t)n * sizeof(int));
+  int *level = (int *)malloc((size_t)n * sizeof(int));
+  int *seeds = (int *)malloc((size_t)n * sizeof(int));
+  DegreeKey *keys = (DegreeKey *)malloc(
+      ((size_t)(maxDeg > n ? maxDeg : n) + 1) * sizeof(DegreeKey));
+  if (!order || !level || !seeds || !keys) {
+    fprintf(stderr, "Error: Memory allocation failed for reordering.\n");
+    free(order);
+    free(level);
+    free(seeds);
+    free(keys);
+    return -1;
+  }
+
+  // RCM seeds components at their minimum-degree vertices
+  for (int v = 0; v < n; v++) {
+    perm[v] = -1;
+    level[v] = -1;
+    keys[v].deg = rcm ? degreeOf(g, v) : 0;
+    keys[v].v = v;
+  }
+  if (rcm)
+    qsort(keys, n, sizeof(DegreeKey), compareDegree);
+  for (int v = 0; v < n; v++)
+    seeds[v] = keys[v].v;
+
+  // The unused tail of `order` is the queue of the peripheral search
+  int count = 0;
+  for (int i = 0; i < n; i++) {
+    int s = seeds[i];
+    if (perm[s] >= 0)
+      continue;
+    int r = rcm ? pseudoPeripheral(g, s, perm, level, order + count) : s;
+    bfsAppend(g, r, rcm, perm, order, &count, keys);
+    // On directed graphs the peripheral vertex may not reach the seed
+    if (perm[s] < 0)
+      bfsAppend(g, s, rcm, perm, order, &count, keys);
+  }
+
+  for (int i = 0; i < n; i++)
+    perm[order[i]] = rcm ? n - 1 - i : i;
+
+  free(order);
+  free(level);
+  free(seeds);
+  free(keys);
+  return 0;
+}
+
+// ---------------------- Public API ----------------------
+int computeOrdering(const CsrGraph *g, ReorderMethod method, int *perm) {
+  if (!g || !perm)
+    return -1;
+  if (g->nn == 0)
+    return 0;
+
+  switch (method) {
+  case REORDER_DEGREE:
+    return degreeOrdering(g, perm);
+  case REORDER_BFS:
+    return bfsOrdering(g, 0, perm);
+  case REORDER_RCM:
+    return bfsOrdering(g, 1, perm);
+  }
+  return -1;
+}
+
+void invertPermutation(const int *perm, int n, int *inv) {
+  for (int v = 0; v < n; v++)
+    inv[perm[v]] = v;
+}
+
+int permuteEdgeList(EdgeList *el, const int *perm) {
+  if (!el || !perm)
+    return -1;
+
+  size_t ne = el->ne > 0 ? (size_t)el->ne : 1;
+  int *src = (int *)malloc(ne * sizeof(int));
+  int *dst = (int *)malloc(ne * sizeof(int));
+  int *cost = el->weighted ? (int *)malloc(ne * sizeof(int)) : NULL;
+  long *pos = (long *)calloc((size_t)el->nn + 1, sizeof(long));
+  if (!src || !dst || (el->weighted && !cost) || !pos) {
+    fprintf(stderr, "Error: Memory allocation failed for reordering.\n");
+    free(src);
+    free(dst);
+    free(cost);
+    free(pos);
+    return -1;
+  }
+
+  memcpy(src, el->src, el->ne * sizeof(int));
+  memcpy(dst, el->dst, el->ne * sizeof(int));
+  if (cost)
+    memcpy(cost, el->cost, el->ne * sizeof(int));
+
+  // Stable counting sort by new source
+  for (long i = 0; i < el->ne; i++)
+    pos[perm[src[i]] + 1]++;
+  for (int v = 0; v < el->nn; v++)
+    pos[v + 1] += pos[v];
+
+  for (long i = 0; i < el->ne; i++) {
+    long k = pos[perm[src[i]]]++;
+    el->src[k] = perm[src[i]];
+    el->dst[k] = perm[dst[i]];
+    if (cost)
+      el->cost[k] = cost[i];
+  }
+
+  free(src);
+  free(dst);
+  free(cost);
+  free(pos);
+  return 0;
+}
+
+CsrGraph *permuteCsr(const CsrGraph *g, const int *perm) {
+  if (!g || !perm)
+    return NULL;
+
+  CsrGraph *p = (CsrGraph *)calloc(1, sizeof(CsrGraph));
+  int *inv = (int *)malloc((g->nn > 0 ? (size_t)g->nn : 1) * sizeof(int));
+  if (!p || !inv) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR graph.\n");
+    free(p);
+    free(inv);
+    return NULL;
+  }
+
+  p->nn = g->nn;
+  p->directed = g->directed;
+  p->na = g->na;
+  p->off = (long *)calloc((size_t)g->nn + 1, sizeof(long));
+  p->adj = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  if (g->cost)
+    p->cost = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  if (!p->off || !p->adj || (g->cost && !p->cost)) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR arrays.\n");
+    free(inv);
+    freeCsr(p);
+    return NULL;
+  }
+
+  invertPermutation(perm, g->nn, inv);
+  for (int w = 0; w < g->nn; w++)
+    p->off[w + 1] = p->off[w] + degreeOf(g, inv[w]);
+
+  for (int w = 0; w < g->nn; w++) {
+    long k = p->off[w];
+    for (long j = g->off[inv[w]]; j < g->off[inv[w] + 1]; j++, k++) {
+      p->adj[k] = perm[g->adj[j]];
+      if (p->cost)
+        p->cost[k] = g->cost[j];
+    }
+  }
+
+  free(inv);
+  return p;
+}
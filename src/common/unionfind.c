@@ -0,0 +1,72 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/unionfind.h"
+
+UnionFind *createUnionFind(int n) {
+  if (n < 0)
+    return NULL;
+
+  UnionFind *uf = (UnionFind *)malloc(sizeof(UnionFind));
+  if (!uf) {
+    fprintf(stderr, "Error: Memory allocation failed for union-find.\n");
+    return NULL;
+  }
+
+  uf->n = n;
+  uf->sets = n;
+  uf->parent = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+  uf->rank = (unsigned char *)calloc(n > 0 ? n : 1, sizeof(unsigned char));
+  if (!uf->parent || !uf->rank) {
+    fprintf(stderr, "Error: Memory allocation failed for union-find arrays.\n");
+    destroyUnionFind(uf);
+    return NULL;
+  }
+
+  for (int i = 0; i < n; i++)
+    uf->parent[i] = i;
+
+  return uf;
+}
+
+int findSet(UnionFind *uf, int x) {
+  int root = x;
+  while (uf->parent[root] != root)
+    root = uf->parent[root];
+
+  // Second pass: compress the path
+  while (uf->parent[x] != root) {
+    int next = uf->parent[x];
+    uf->parent[x] = root;
+    x = next;
+  }
+
+  return root;
+}
+
+int unionSets(UnionFind *uf, int a, int b) {
+  int ra = findSet(uf, a);
+  int rb = findSet(uf, b);
+  if (ra == rb)
+    return 0;
+
+  if (uf->rank[ra] < uf->rank[rb]) {
+    int aux = ra;
+    ra = rb;
+    rb = aux;
+  }
+  uf->parent[rb] = ra;
+  if (uf->rank[ra] == uf->rank[rb])
+    uf->rank[ra]++;
+
+  uf->sets--;
+  return 1;
+}
+
+void destroyUnionFind(UnionFind *uf) {
+  if (!uf)
+    return;
+  free(uf->parent);
+  free(uf->rank);
+  free(uf);
+}
@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../common/include/unionfind.h"
+#include "include/Components.h"
+
+// ---------------------- Label Helpers ----------------------
+/* Renumbers union-find roots to 0, 1, ... by smallest member vertex. */
+static int labelsFromUnionFind(UnionFind *uf, int *label) {
+  int *index = (int *)malloc((uf->n > 0 ? uf->n : 1) * sizeof(int));
+  if (!index) {
+    fprintf(stderr, "Error: Memory allocation failed for component index.\n");
+    return -1;
+  }
+
+  for (int v = 0; v < uf->n; v++)
+    index[v] = -1;
+
+  int count = 0;
+  for (int v = 0; v < uf->n; v++) {
+    int root = findSet(uf, v);
+    if (index[root] < 0)
+      index[root] = count++;
+    label[v] = index[root];
+  }
+
+  free(index);
+  return count;
+}
+
+// ---------------------- Union-Find Backend ----------------------
+int componentsUnionFind(const EdgeList *el, int *label) {
+  if (!el || !label)
+    return -1;
+
+  UnionFind *uf = createUnionFind(el->nn);
+  if (!uf)
+    return -1;
+
+  for (long i = 0; i < el->ne; i++)
+    unionSets(uf, el->src[i], el->dst[i]);
+
+  int count = labelsFromUnionFind(uf, label);
+  destroyUnionFind(uf);
+  return count;
+}
+
+int connectedComponents(TGraphL *graph, int *label) {
+  if (!graph || !label)
+    return -1;
+
+  UnionFind *uf = createUnionFind(graph->nn);
+  if (!uf)
+    return -1;
+
+  for (int u = 0; u < graph->nn; u++) {
+    for (TNode *nod = graph->adl[u]; nod; nod = nod->next) {
+      if (u < nod->v) // each undirected edge is stored twice
+        unionSets(uf, u, nod->v);
+    }
+  }
+
+  int count = labelsFromUnionFind(uf, label);
+  destroyUnionFind(uf);
+  return count;
+}
+
+// ---------------------- Label Propagation Backend ----------------------
+int componentsLabelPropagation(const CsrGraph *g, int *label) {
+  if (!g || !label)
+    return -1;
+
+  int n = g->nn;
+
+#pragma omp parallel for schedule(static)
+  for (int v = 0; v < n; v++)
+    label[v] = v;
+
+  // Labels only decrease and label[v] <= v, so concurrent reads of a stale
+  // (larger) value merely delay convergence by a round.
+  int changed = 1;
+  while (changed) {
+    changed = 0;
+
+#pragma omp parallel for schedule(dynamic, 1024) reduction(| : changed)
+    for (int v = 0; v < n; v++) {
+      int best = __atomic_load_n(&label[v], __ATOMIC_RELAXED);
+      for (long k = g->off[v]; k < g->off[v + 1]; k++) {
+        int l = __atomic_load_n(&label[g->adj[k]], __ATOMIC_RELAXED);
+        if (l < best)
+          best = l;
+      }
+
+      // Pointer jumping: the label of a label is never larger
+      int jump = __atomic_load_n(&label[best], __ATOMIC_RELAXED);
+      if (jump < best)
+        best = jump;
+
+      if (best < __atomic_load_n(&label[v], __ATOMIC_RELAXED)) {
+        __atomic_store_n(&label[v], best, __ATOMIC_RELAXED);
+        changed = 1;
+      }
+    }
+  }
+
+  // Every label is now the smallest vertex of its component; roots come
+  // first in vertex order, so the renumbering can be done in place.
+  int count = 0;
+  for (int v = 0; v < n; v++) {
+    if (label[v] == v)
+      label[v] = count++;
+    else
+      label[v] = label[label[v]];
+  }
+
+  return count;
+}
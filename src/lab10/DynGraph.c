@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/DynGraph.h"
+
+// ---------------------- Create Graph ----------------------
+TGraphD *createGraphDyn(int numberOfNodes) {
+  if (numberOfNodes < 0)
+    return NULL;
+
+  TGraphD *graph = (TGraphD *)malloc(sizeof(TGraphD));
+  if (!graph) {
+    fprintf(stderr, "Error: Memory allocation failed for graph structure.\n");
+    return NULL;
+  }
+
+  int n = numberOfNodes > 0 ? numberOfNodes : 1;
+  graph->nn = numberOfNodes;
+  graph->deg = (int *)calloc(n, sizeof(int));
+  graph->cap = (int *)calloc(n, sizeof(int));
+  graph->adj = (DynArc **)calloc(n, sizeof(DynArc *));
+
+  if (!graph->deg || !graph->cap || !graph->adj) {
+    fprintf(stderr, "Error: Memory allocation failed for adjacency arrays.\n");
+    destroyGraphDyn(graph);
+    return NULL;
+  }
+
+  return graph;
+}
+
+// ---------------------- Add Edge ----------------------
+/* Makes room for `extra` more arcs in adj[u]. */
+static int reserveArcs(TGraphD *graph, int u, int extra) {
+  if (graph->deg[u] + extra <= graph->cap[u])
+    return 1;
+
+  int cap = graph->cap[u] ? 2 * graph->cap[u] : 4;
+  while (cap < graph->deg[u] + extra)
+    cap *= 2;
+
+  DynArc *arcs = (DynArc *)realloc(graph->adj[u], cap * sizeof(DynArc));
+  if (!arcs) {
+    fprintf(stderr, "Error: Memory allocation failed for edge.\n");
+    return 0;
+  }
+
+  graph->adj[u] = arcs;
+  graph->cap[u] = cap;
+  return 1;
+}
+
+int addEdgeDyn(TGraphD *graph, int v1, int v2) {
+  if (!graph || v1 < 0 || v2 < 0 || v1 >= graph->nn || v2 >= graph->nn)
+    return -1;
+
+  if (!reserveArcs(graph, v1, v1 == v2 ? 2 : 1) || !reserveArcs(graph, v2, 1))
+    return -1;
+
+  int i = graph->deg[v1]++;
+  int j = graph->deg[v2]++;
+  graph->adj[v1][i] = (DynArc){v2, j};
+  graph->adj[v2][j] = (DynArc){v1, i};
+
+  return i;
+}
+
+// ---------------------- Remove Edge ----------------------
+/* Swap-with-last removal of adj[u][i], re-pointing the moved arc's twin. */
+static void removeSlot(TGraphD *graph, int u, int i) {
+  int last = --graph->deg[u];
+  if (i == last)
+    return;
+
+  DynArc moved = graph->adj[u][last];
+  graph->adj[u][i] = moved;
+  graph->adj[moved.v][moved.rev].rev = i;
+}
+
+void removeArcDyn(TGraphD *graph, int u, int i) {
+  if (!graph || u < 0 || u >= graph->nn || i < 0 || i >= graph->deg[u])
+    return;
+
+  DynArc arc = graph->adj[u][i];
+
+  if (arc.v == u) {
+    // Self-loop: both arcs live in adj[u], drop the higher slot first so
+    // the lower one is not moved underneath us
+    int hi = i > arc.rev ? i : arc.rev;
+    int lo = i > arc.rev ? arc.rev : i;
+    removeSlot(graph, u, hi);
+    removeSlot(graph, u, lo);
+    return;
+  }
+
+  removeSlot(graph, arc.v, arc.rev);
+  removeSlot(graph, u, i);
+}
+
+int removeEdgeDyn(TGraphD *graph, int v1, int v2) {
+  if (!graph || v1 < 0 || v2 < 0 || v1 >= graph->nn || v2 >= graph->nn)
+    return 0;
+
+  if (graph->deg[v2] < graph->deg[v1]) {
+    int aux = v1;
+    v1 = v2;
+    v2 = aux;
+  }
+
+  for (int i = 0; i < graph->deg[v1]; i++) {
+    if (graph->adj[v1][i].v == v2) {
+      removeArcDyn(graph, v1, i);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// ---------------------- Remove Node ----------------------
+void removeNodeDyn(TGraphD *graph, int v) {
+  if (!graph || v < 0 || v >= graph->nn)
+    return;
+
+  // Each removal is O(1), so isolating v costs O(deg(v))
+  while (graph->deg[v] > 0)
+    removeArcDyn(graph, v, graph->deg[v] - 1);
+}
+
+// ---------------------- Destroy Graph ----------------------
+void destroyGraphDyn(TGraphD *graph) {
+  if (!graph)
+    return;
+
+  if (graph->adj) {
+    for (int i = 0; i < graph->nn; i++)
+      free(graph->adj[i]);
+    free(graph->adj);
+  }
+  free(graph->deg);
+  free(graph->cap);
+  free(graph);
+}
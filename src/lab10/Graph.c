@@ -34,29 +34,125 @@ TGraphL *createGraphAdjList(int numberOfNodes) {
 }
 
 // ---------------------- Add Edge ----------------------
-void addEdgeList(TGraphL *graph, int v1, int v2) {
+int addArcList(TGraphL *graph, int u, int v, int c) {
+  if (!graph || !graph->adl || u < 0 || v < 0 || u >= graph->nn ||
+      v >= graph->nn)
+    return -1;
+
+  TNode *newNode = (TNode *)malloc(sizeof(TNode));
+  if (!newNode) {
+    fprintf(stderr, "Error: Memory allocation failed for edge.\n");
+    return -1;
+  }
+  newNode->v = v;
+  newNode->c = c;
+  newNode->next = graph->adl[u];
+  graph->adl[u] = newNode;
+  return 0;
+}
+
+int addWeightedEdgeList(TGraphL *graph, int v1, int v2, int c) {
   if (!graph || !graph->adl || v1 < 0 || v2 < 0 || v1 >= graph->nn ||
       v2 >= graph->nn)
-    return;
+    return -1;
 
   TNode *newNode1 = (TNode *)malloc(sizeof(TNode));
   if (!newNode1) {
     fprintf(stderr, "Error: Memory allocation failed for edge.\n");
-    return;
+    return -1;
   }
   newNode1->v = v2;
+  newNode1->c = c;
   newNode1->next = graph->adl[v1];
   graph->adl[v1] = newNode1;
 
   TNode *newNode2 = (TNode *)malloc(sizeof(TNode));
   if (!newNode2) {
     fprintf(stderr, "Error: Memory allocation failed for edge.\n");
-    free(newNode1); // Prevent memory leak
-    return;
+    graph->adl[v1] = newNode1->next; // Prevent a half-added edge
+    free(newNode1);
+    return -1;
   }
   newNode2->v = v1;
+  newNode2->c = c;
   newNode2->next = graph->adl[v2];
   graph->adl[v2] = newNode2;
+  return 0;
+}
+
+void addEdgeList(TGraphL *graph, int v1, int v2) {
+  addWeightedEdgeList(graph, v1, v2, 0);
+}
+
+// ---------------------- Shared Formats ----------------------
+TGraphL *createGraphFromEdgeList(const EdgeList *el) {
+  if (!el)
+    return NULL;
+
+  TGraphL *graph = createGraphAdjList(el->nn);
+  if (!graph)
+    return NULL;
+
+  for (long i = 0; i < el->ne; i++) {
+    int c = el->weighted ? el->cost[i] : 0;
+    int status = el->directed
+                     ? addArcList(graph, el->src[i], el->dst[i], c)
+                     : addWeightedEdgeList(graph, el->src[i], el->dst[i], c);
+    if (status != 0) {
+      fprintf(stderr, "Error: Could not add edge (%d, %d).\n", el->src[i],
+              el->dst[i]);
+      destroyGraphAdjList(graph);
+      return NULL;
+    }
+  }
+
+  return graph;
+}
+
+CsrGraph *graphToCsr(const TGraphL *graph, int directed) {
+  if (!graph)
+    return NULL;
+
+  CsrGraph *g = (CsrGraph *)calloc(1, sizeof(CsrGraph));
+  if (!g) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR graph.\n");
+    return NULL;
+  }
+
+  g->nn = graph->nn;
+  g->directed = directed;
+  g->off = (long *)calloc((size_t)graph->nn + 1, sizeof(long));
+  if (!g->off) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR offsets.\n");
+    freeCsr(g);
+    return NULL;
+  }
+
+  for (int u = 0; u < graph->nn; u++) {
+    long deg = 0;
+    for (TNode *nod = graph->adl[u]; nod; nod = nod->next)
+      deg++;
+    g->off[u + 1] = g->off[u] + deg;
+  }
+
+  g->na = g->off[graph->nn];
+  g->adj = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  g->cost = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  if (!g->adj || !g->cost) {
+    fprintf(stderr, "Error: Memory allocation failed for CSR arrays.\n");
+    freeCsr(g);
+    return NULL;
+  }
+
+  for (int u = 0; u < graph->nn; u++) {
+    long k = g->off[u];
+    for (TNode *nod = graph->adl[u]; nod; nod = nod->next, k++) {
+      g->adj[k] = nod->v;
+      g->cost[k] = nod->c;
+    }
+  }
+
+  return g;
 }
 
 // ---------------------- DFS Traversal ----------------------
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "include/MsBfs.h"
+
+// ---------------------- One Batch ----------------------
+/*
+ * Runs up to MSBFS_WIDTH searches together. `seen`, `frontier` and `next`
+ * hold `g->nn` words each; on return `seen[v]` has bit i set iff `v` is
+ * reachable from `sources[i]`. If `dist` is not NULL its rows (already set
+ * to -1) receive the level at which each bit was first set.
+ */
+static void msBfsBatch(const CsrGraph *g, const int *sources, int count,
+                       uint64_t *seen, uint64_t *frontier, uint64_t *next,
+                       int *dist) {
+  int n = g->nn;
+  memset(seen, 0, (size_t)n * sizeof(uint64_t));
+  memset(frontier, 0, (size_t)n * sizeof(uint64_t));
+  memset(next, 0, (size_t)n * sizeof(uint64_t));
+
+  for (int i = 0; i < count; i++) {
+    uint64_t bit = (uint64_t)1 << i;
+    seen[sources[i]] |= bit;
+    frontier[sources[i]] |= bit;
+    if (dist)
+      dist[(long)i * n + sources[i]] = 0;
+  }
+
+  int active = count > 0;
+  for (int level = 1; active; level++) {
+    // Expand: one scan of u's arcs serves every search with u in its frontier
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (int u = 0; u < n; u++) {
+      uint64_t f = frontier[u];
+      if (!f)
+        continue;
+      for (long k = g->off[u]; k < g->off[u + 1]; k++) {
+        int v = g->adj[k];
+        uint64_t d = f & ~seen[v];
+        if (d) {
+#pragma omp atomic
+          next[v] |= d;
+        }
+      }
+    }
+
+    // Settle: bits new to v form its next frontier
+    active = 0;
+#pragma omp parallel for schedule(static) reduction(| : active)
+    for (int v = 0; v < n; v++) {
+      uint64_t d = next[v] & ~seen[v];
+      next[v] = 0;
+      frontier[v] = d;
+      if (!d)
+        continue;
+
+      seen[v] |= d;
+      active = 1;
+      while (dist && d) {
+        dist[(long)__builtin_ctzll(d) * n + v] = level;
+        d &= d - 1;
+      }
+    }
+  }
+}
+
+// ---------------------- Batches ----------------------
+/* Validates the arguments and runs every batch; `dist` or `reach` may be NULL. */
+static int msBfsRun(const CsrGraph *g, const int *sources, int numSources,
+                    int *dist, uint64_t *reach) {
+  if (!g || (!sources && numSources > 0) || numSources < 0)
+    return -1;
+
+  int n = g->nn;
+  for (int i = 0; i < numSources; i++) {
+    if (sources[i] < 0 || sources[i] >= n) {
+      fprintf(stderr, "Error: Invalid source vertex %d.\n", sources[i]);
+      return -1;
+    }
+  }
+
+  size_t words = n > 0 ? (size_t)n : 1;
+  uint64_t *seen = (uint64_t *)malloc(words * sizeof(uint64_t));
+  uint64_t *frontier = (uint64_t *)malloc(words * sizeof(uint64_t));
+  uint64_t *next = (uint64_t *)malloc(words * sizeof(uint64_t));
+  if (!seen || !frontier || !next) {
+    fprintf(stderr, "Error: Memory allocation failed for MS-BFS.\n");
+    free(seen);
+    free(frontier);
+    free(next);
+    return -1;
+  }
+
+  if (dist) {
+    for (long i = 0; i < (long)numSources * n; i++)
+      dist[i] = -1;
+  }
+
+  for (int base = 0; base < numSources; base += MSBFS_WIDTH) {
+    int count = numSources - base < MSBFS_WIDTH ? numSources - base
+                                                : MSBFS_WIDTH;
+    msBfsBatch(g, sources + base, count, seen, frontier, next,
+               dist ? dist + (long)base * n : NULL);
+    if (reach)
+      memcpy(reach + (size_t)(base / MSBFS_WIDTH) * n, seen,
+             (size_t)n * sizeof(uint64_t));
+  }
+
+  free(seen);
+  free(frontier);
+  free(next);
+  return 0;
+}
+
+int msBfsDistances(const CsrGraph *g, const int *sources, int numSources,
+                   int *dist) {
+  if (!dist)
+    return -1;
+  return msBfsRun(g, sources, numSources, dist, NULL);
+}
+
+int msBfsReachability(const CsrGraph *g, const int *sources, int numSources,
+                      uint64_t *reach) {
+  if (!reach)
+    return -1;
+  return msBfsRun(g, sources, numSources, NULL, reach);
+}
@@ -0,0 +1,53 @@
+#ifndef COMPONENTS_H_
+#define COMPONENTS_H_
+
+#include "../../common/include/csr.h"
+#include "../../common/include/graphio.h"
+#include "Graph.h"
+
+/*
+ * Connected components of an undirected graph.
+ *
+ * Every function fills `label[v]` (caller allocated, one entry per vertex)
+ * with the index of the component containing `v`. Components are numbered
+ * 0, 1, ... in increasing order of their smallest vertex, so all backends
+ * return identical labellings for the same graph.
+ */
+
+/**
+ * @brief Labels components by streaming the edges through a union-find.
+ *
+ * No adjacency structure is built; memory is O(V) besides the edge list.
+ *
+ * @param el Edge list of the graph (direction is ignored).
+ * @param label Output array of `el->nn` component indices.
+ * @return Number of components, or -1 on error.
+ */
+int componentsUnionFind(const EdgeList *el, int *label);
+
+/**
+ * @brief Labels components by parallel min-label propagation on a CSR graph.
+ *
+ * Each round every vertex takes the smallest label among itself and its
+ * neighbours, followed by a pointer-jumping shortcut, until nothing changes.
+ * Rounds run in parallel when compiled with OpenMP.
+ *
+ * @param g CSR graph storing both directions of every edge.
+ * @param label Output array of `g->nn` component indices.
+ * @return Number of components, or -1 on error.
+ */
+int componentsLabelPropagation(const CsrGraph *g, int *label);
+
+/**
+ * @brief Labels components of an adjacency-list graph.
+ *
+ * Streams the adjacency lists through a union-find, so a single O(V) buffer
+ * replaces the per-call visited arrays of repeated `bfs` calls.
+ *
+ * @param graph Pointer to the graph.
+ * @param label Output array of `graph->nn` component indices.
+ * @return Number of components, or -1 on error.
+ */
+int connectedComponents(TGraphL *graph, int *label);
+
+#endif /* COMPONENTS_H_ */
@@ -0,0 +1,84 @@
+#ifndef DYNGRAPH_H_
+#define DYNGRAPH_H_
+
+/**
+ * @brief Arc stored in a dynamic adjacency array.
+ *
+ * `rev` is the index of the twin arc (v -> u) inside `adj[v]`, which lets an
+ * undirected edge be unlinked from both endpoints without searching.
+ */
+typedef struct {
+  int v;
+  int rev;
+} DynArc;
+
+/**
+ * @brief Undirected graph with per-vertex dense adjacency arrays.
+ *
+ * Removing an arc moves the last arc of the array into the freed slot, so
+ * edge removal is O(1) given a handle and vertex removal is O(deg). Arc order
+ * is therefore not preserved, and a handle `(u, i)` is only valid until the
+ * next removal touching `adj[u]`.
+ */
+typedef struct {
+  int nn;
+  int *deg;
+  int *cap;
+  DynArc **adj;
+} TGraphD;
+
+/**
+ * @brief Creates a dynamic graph with a specified number of vertices.
+ *
+ * @param numberOfNodes The number of vertices in the graph.
+ * @return Pointer to the created graph, or NULL if memory allocation fails.
+ */
+TGraphD *createGraphDyn(int numberOfNodes);
+
+/**
+ * @brief Adds an undirected edge between two vertices.
+ *
+ * @param graph Pointer to the graph.
+ * @param v1 First vertex.
+ * @param v2 Second vertex.
+ * @return Index of the new arc in `adj[v1]` (its handle), or -1 on error.
+ */
+int addEdgeDyn(TGraphD *graph, int v1, int v2);
+
+/**
+ * @brief Removes the edge whose arc sits at `adj[u][i]`, in O(1).
+ *
+ * @param graph Pointer to the graph.
+ * @param u Vertex owning the arc.
+ * @param i Index of the arc in `adj[u]`.
+ */
+void removeArcDyn(TGraphD *graph, int u, int i);
+
+/**
+ * @brief Removes one undirected edge between two vertices.
+ *
+ * Only the smaller of the two adjacency arrays is searched.
+ *
+ * @param graph Pointer to the graph.
+ * @param v1 First vertex.
+ * @param v2 Second vertex.
+ * @return 1 if an edge was removed, 0 otherwise.
+ */
+int removeEdgeDyn(TGraphD *graph, int v1, int v2);
+
+/**
+ * @brief Removes all edges incident to a vertex in O(deg).
+ *
+ * @param graph Pointer to the graph.
+ * @param v Vertex to isolate.
+ */
+void removeNodeDyn(TGraphD *graph, int v);
+
+/**
+ * @brief Frees all allocated memory for the graph.
+ *
+ * @param graph Pointer to the graph.
+ */
+void destroyGraphDyn(TGraphD *graph);
+
+#endif /* DYNGRAPH_H_ */
@@ -1,15 +1,19 @@
 #ifndef GRAPH_H_
 #define GRAPH_H_
 
+#include "../../common/include/csr.h"
+#include "../../common/include/graphio.h"
 #include "Util.h"
 
 /**
  * @brief Node structure for the adjacency list representation of a graph.
  *
- * Each node represents a destination vertex in the adjacency list.
+ * Each node represents a destination vertex in the adjacency list and the
+ * cost of the arc (0 for unweighted graphs). Same layout as the lab11 node.
  */
 typedef struct TNode {
   int v;
+  int c;
   struct TNode *next;
 } TNode, *ATNode;
 
@@ -44,6 +48,58 @@ TGraphL *createGraphAdjList(int numberOfNodes);
  */
 void addEdgeList(TGraphL *graph, int v1, int v2);
 
+/**
+ * @brief Adds an undirected edge with cost `c` between two vertices.
+ *
+ * @param graph Pointer to the graph.
+ * @param v1 First vertex.
+ * @param v2 Second vertex.
+ * @param c Cost of the edge.
+ * @return 0 on success, -1 if a vertex is out of range or memory allocation
+ *         fails (the graph is then unchanged).
+ */
+int addWeightedEdgeList(TGraphL *graph, int v1, int v2, int c);
+
+/**
+ * @brief Adds a directed arc `u -> v` with cost `c`.
+ *
+ * Only `adl[u]` changes. `removeEdgeList` and `removeNodeList` assume
+ * undirected edges and also drop the reverse arc if there is one.
+ *
+ * @param graph Pointer to the graph.
+ * @param u Source vertex.
+ * @param v Target vertex.
+ * @param c Cost of the arc.
+ * @return 0 on success, -1 if a vertex is out of range or memory allocation
+ *         fails (the graph is then unchanged).
+ */
+int addArcList(TGraphL *graph, int u, int v, int c);
+
+/**
+ * @brief Builds a graph from a shared edge list (see `graphio.h`).
+ *
+ * Directed lists add one arc per edge, undirected lists one edge; costs are
+ * copied for weighted lists and 0 otherwise. The lists end up exactly as
+ * with one `addEdgeList` / `addArcList` call per edge.
+ *
+ * @param el Edge list.
+ * @return Pointer to the graph, or NULL if an edge has an endpoint outside
+ *         `0 .. nn - 1` or memory allocation fails.
+ */
+TGraphL *createGraphFromEdgeList(const EdgeList *el);
+
+/**
+ * @brief Builds a CSR copy of the graph (see `csr.h`).
+ *
+ * Arcs of each vertex keep adjacency list order; every CSR algorithm of the
+ * labs and of the shared library can then run on it.
+ *
+ * @param graph Pointer to the graph.
+ * @param directed 1 if the graph holds arcs added with `addArcList`.
+ * @return Pointer to the CSR graph, or NULL if memory allocation fails.
+ */
+CsrGraph *graphToCsr(const TGraphL *graph, int directed);
+
 /**
  * @brief Removes an undirected edge between two vertices.
  *
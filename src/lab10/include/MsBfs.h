@@ -0,0 +1,48 @@
+#ifndef MSBFS_H_
+#define MSBFS_H_
+
+#include <stdint.h>
+
+#include "../../common/include/csr.h"
+
+/* Sources traversed together, one bit of a 64-bit word each. */
+#define MSBFS_WIDTH 64
+
+/*
+ * Bit-parallel multi-source BFS (MS-BFS).
+ *
+ * Up to MSBFS_WIDTH sources share one traversal: every vertex keeps a
+ * `seen` and a `frontier` bit mask with one bit per source, so a single scan
+ * of an arc `u -> v` advances all searches that have `u` in their frontier.
+ * More sources are processed in batches of MSBFS_WIDTH. Levels run in
+ * parallel when compiled with OpenMP.
+ */
+
+/**
+ * @brief Computes hop distances from every source.
+ *
+ * @param g CSR graph (out-arcs; undirected edges stored in both directions).
+ * @param sources Source vertices.
+ * @param numSources Number of sources.
+ * @param dist Output, `numSources x g->nn` row-major: `dist[i * nn + v]` is
+ * the number of arcs from `sources[i]` to `v`, -1 if unreachable.
+ * @return 0 on success, -1 on error.
+ */
+int msBfsDistances(const CsrGraph *g, const int *sources, int numSources,
+                   int *dist);
+
+/**
+ * @brief Computes the set of vertices reachable from every source.
+ *
+ * @param g CSR graph (out-arcs; undirected edges stored in both directions).
+ * @param sources Source vertices.
+ * @param numSources Number of sources.
+ * @param reach Output, `ceil(numSources / MSBFS_WIDTH) x g->nn` words:
+ * bit `i % MSBFS_WIDTH` of `reach[(i / MSBFS_WIDTH) * nn + v]` is set iff
+ * `v` is reachable from `sources[i]`.
+ * @return 0 on success, -1 on error.
+ */
+int msBfsReachability(const CsrGraph *g, const int *sources, int numSources,
+                      uint64_t *reach);
+
+#endif /* MSBFS_H_ */
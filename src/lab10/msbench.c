@@ -0,0 +1,148 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "include/Graph.h"
+#include "include/MsBfs.h"
+#include "include/Util.h"
+#include "../common/include/graphgen.h"
+
+/*
+ * Benchmarks MS-BFS against one traversal per source on random undirected
+ * graphs (Erdos-Renyi and R-MAT): repeated `bfs` on the adjacency lists,
+ * repeated single-source BFS on the same CSR graph, and MS-BFS distances and
+ * reachability. The CSR BFS distances must equal the MS-BFS matrix, and the
+ * vertices `bfs` visits must equal the MS-BFS reachability sets.
+ *
+ * Usage: msbench [V=50000] [sources=64]
+ */
+
+#define AVG_DEGREE 8
+#define SEED 7
+
+static double nowMs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+/* Plain single-source BFS over the CSR arcs, `queue` holds nn entries. */
+static void csrBfs(const CsrGraph *g, int s, int *dist, int *queue) {
+  for (int v = 0; v < g->nn; v++)
+    dist[v] = -1;
+
+  int head = 0, tail = 0;
+  dist[s] = 0;
+  queue[tail++] = s;
+  while (head < tail) {
+    int u = queue[head++];
+    for (long k = g->off[u]; k < g->off[u + 1]; k++) {
+      if (dist[g->adj[k]] < 0) {
+        dist[g->adj[k]] = dist[u] + 1;
+        queue[tail++] = g->adj[k];
+      }
+    }
+  }
+}
+
+static int runCase(GraphGenKind kind, int nn, int k) {
+  size_t words = (size_t)((k + MSBFS_WIDTH - 1) / MSBFS_WIDTH) * nn;
+  EdgeList *el = generateGraph(kind, nn, (long)nn * AVG_DEGREE, 0, 0, SEED);
+  TGraphL *graph = el ? createGraphFromEdgeList(el) : NULL;
+  CsrGraph *csr = graph ? graphToCsr(graph, 0) : NULL;
+  int *sources = (int *)malloc(k * sizeof(int));
+  int *dist = (int *)malloc((size_t)k * nn * sizeof(int));
+  int *ref = (int *)malloc((size_t)k * nn * sizeof(int));
+  int *queue = (int *)malloc(nn * sizeof(int));
+  uint64_t *reach = (uint64_t *)malloc(words * sizeof(uint64_t));
+  List **orders = (List **)calloc(k, sizeof(List *));
+
+  int ok = 0;
+  if (!csr || !sources || !dist || !ref || !queue || !reach || !orders) {
+    fprintf(stderr, "Error: Memory allocation failed for benchmark.\n");
+    goto cleanup;
+  }
+
+  // Endpoints of evenly spaced edges, so no source is isolated
+  for (int i = 0; i < k; i++)
+    sources[i] = el->src[(long)i * el->ne / k];
+
+  // Repeated bfs on the lists; the visited sets are checked below
+  ok = 1;
+  double t0 = nowMs();
+  for (int i = 0; i < k; i++)
+    orders[i] = bfs(graph, sources[i]);
+  double listMs = nowMs() - t0;
+
+  t0 = nowMs();
+  for (int i = 0; i < k; i++)
+    csrBfs(csr, sources[i], ref + (long)i * nn, queue);
+  double csrMs = nowMs() - t0;
+
+  t0 = nowMs();
+  ok &= msBfsDistances(csr, sources, k, dist) == 0;
+  double msMs = nowMs() - t0;
+
+  t0 = nowMs();
+  ok &= msBfsReachability(csr, sources, k, reach) == 0;
+  double reachMs = nowMs() - t0;
+
+  for (int i = 0; i < k && ok; i++) {
+    size_t at = (size_t)i * nn;
+    if (!orders[i] || memcmp(dist + at, ref + at, nn * sizeof(int)) != 0) {
+      ok = 0;
+      break;
+    }
+    uint64_t *row = reach + (size_t)(i / MSBFS_WIDTH) * nn;
+    long visited = 0;
+    for (ListNode *it = orders[i]->head->next; it != orders[i]->head;
+         it = it->next, visited++)
+      ok &= (int)((row[it->key] >> (i % MSBFS_WIDTH)) & 1);
+    long reached = 0;
+    for (int v = 0; v < nn; v++)
+      reached += (row[v] >> (i % MSBFS_WIDTH)) & 1;
+    ok &= visited == reached;
+  }
+
+  printf("%-5s %12.1f %12.1f %12.1f %12.1f %9.1fx   %s\n", graphGenName(kind),
+         listMs, csrMs, msMs, reachMs, csrMs / msMs, ok ? "same" : "DIFFERENT");
+
+cleanup:
+  for (int i = 0; orders && i < k; i++) {
+    if (orders[i])
+      destroyList(orders[i]);
+  }
+  free(orders);
+  free(sources);
+  free(dist);
+  free(ref);
+  free(queue);
+  free(reach);
+  freeCsr(csr);
+  destroyGraphAdjList(graph);
+  freeEdgeList(el);
+  return ok;
+}
+
+int main(int argc, char *argv[]) {
+  int nn = argc > 1 ? atoi(argv[1]) : 50000;
+  int k = argc > 2 ? atoi(argv[2]) : MSBFS_WIDTH;
+  if (nn < 2 || k <= 0) {
+    fprintf(stderr, "Usage: %s [V] [sources]\n", argv[0]);
+    return 1;
+  }
+
+  printf("V = %d, E = %ld, %d sources\n", nn, (long)nn * AVG_DEGREE, k);
+  printf("%-5s %12s %12s %12s %12s %10s   %s\n", "graph", "bfs (ms)",
+         "csr bfs (ms)", "ms-bfs (ms)", "reach (ms)", "vs csr", "results");
+
+  int ok = runCase(GRAPHGEN_ERDOS_RENYI, nn, k);
+  ok &= runCase(GRAPHGEN_RMAT, nn, k);
+
+  printf(ok ? "MS-BFS and per-source BFS match\n"
+            : "MS-BFS and per-source BFS DIFFER\n");
+  return ok ? 0 : 1;
+}
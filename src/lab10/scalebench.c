@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/Graph.h"
+#include "include/Util.h"
+#include "../common/include/benchrun.h"
+#include "../common/include/graphgen.h"
+
+/*
+ * Scale benchmark of `bfs` and `dfs` on synthetic undirected graphs
+ * (Erdos-Renyi, R-MAT, grid) of doubling size, AVG_DEGREE edges per vertex,
+ * starting from the first edge's endpoint so the source is never isolated.
+ * Prints CSV (see benchrun.h) to stdout.
+ *
+ * `dfs` recurses once per vertex on the path, so on grids of ~1e5 vertices
+ * it overflows the default 8 MiB stack; that run is reported as failed.
+ *
+ * Usage: scalebench [maxV=65536]
+ */
+
+#define MIN_V 1024
+#define AVG_DEGREE 8
+#define SEED 42
+
+typedef struct {
+  TGraphL *graph;
+  int source;
+} TraversalCtx;
+
+static void runBfs(void *ctx) {
+  TraversalCtx *t = (TraversalCtx *)ctx;
+  destroyList(bfs(t->graph, t->source));
+}
+
+static void runDfs(void *ctx) {
+  TraversalCtx *t = (TraversalCtx *)ctx;
+  destroyList(dfs(t->graph, t->source));
+}
+
+int main(int argc, char *argv[]) {
+  int maxV = argc > 1 ? atoi(argv[1]) : 65536;
+  if (maxV < MIN_V) {
+    fprintf(stderr, "Usage: %s [maxV >= %d]\n", argv[0], MIN_V);
+    return 1;
+  }
+
+  const GraphGenKind kinds[] = {GRAPHGEN_ERDOS_RENYI, GRAPHGEN_RMAT,
+                                GRAPHGEN_GRID};
+  int failures = 0;
+
+  benchCsvHeader(stdout);
+  for (int k = 0; k < 3; k++) {
+    for (int nn = MIN_V; nn <= maxV; nn *= 2) {
+      EdgeList *el =
+          generateGraph(kinds[k], nn, (long)nn * AVG_DEGREE, 0, 0, SEED);
+      TGraphL *graph = el ? createGraphAdjList(el->nn) : NULL;
+      if (!graph) {
+        freeEdgeList(el);
+        return 1;
+      }
+      for (long i = 0; i < el->ne; i++)
+        addEdgeList(graph, el->src[i], el->dst[i]);
+
+      TraversalCtx ctx = {graph, el->src[0]};
+      BenchCase bc = {"lab10", "bfs", graphGenName(kinds[k]), el->nn, el->ne};
+      failures += benchRun(stdout, &bc, runBfs, &ctx) != 0;
+      bc.algorithm = "dfs";
+      failures += benchRun(stdout, &bc, runDfs, &ctx) != 0;
+
+      destroyGraphAdjList(graph);
+      freeEdgeList(el);
+    }
+  }
+
+  return failures ? 1 : 0;
+}
@@ -2,8 +2,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "include/Components.h"
+#include "include/DynGraph.h"
 #include "include/Graph.h"
+#include "include/MsBfs.h"
 #include "include/Util.h"
+#include "../common/include/graphio.h"
 
 // -----------------------------------------------------------------------------
 void buildGraphsFromFile(TGraphL **gl);
@@ -118,6 +122,156 @@ int testBFS(TGraphL **gl, float score) {
   return 1;
 }
 
+int testComponents(TGraphL **gl, float score) {
+  int label[6];
+  ASSERT(connectedComponents(*gl, label) == 1, "Components-01");
+  for (int v = 0; v < (*gl)->nn; v++) {
+    ASSERT(label[v] == 0, "Components-02");
+  }
+
+  // 0-3-5, 1-2, 4 isolated, 6-7 (with a duplicate edge)
+  int src[] = {3, 2, 0, 6, 7}, dst[] = {5, 1, 3, 7, 6};
+  EdgeList el = {.nn = 8, .ne = 5, .src = src, .dst = dst};
+  int expected[] = {0, 1, 1, 0, 2, 0, 3, 3};
+
+  int ufLabel[8], lpLabel[8];
+  ASSERT(componentsUnionFind(&el, ufLabel) == 4, "Components-03");
+
+  CsrGraph *csr = buildCsr(&el);
+  ASSERT(csr != NULL, "Components-04");
+  int lpCount = componentsLabelPropagation(csr, lpLabel);
+  freeCsr(csr);
+  ASSERT(lpCount == 4, "Components-05");
+
+  for (int v = 0; v < el.nn; v++) {
+    ASSERT(ufLabel[v] == expected[v], "Components-06");
+    ASSERT(lpLabel[v] == expected[v], "Components-07");
+  }
+
+  passed2("Connected Components", score);
+  return 1;
+}
+
+/* Every arc must be matched by its twin through the reverse index. */
+int dynTwinsConsistent(TGraphD *gd) {
+  for (int u = 0; u < gd->nn; u++) {
+    for (int i = 0; i < gd->deg[u]; i++) {
+      DynArc a = gd->adj[u][i];
+      if (a.rev >= gd->deg[a.v] || gd->adj[a.v][a.rev].v != u ||
+          gd->adj[a.v][a.rev].rev != i)
+        return 0;
+    }
+  }
+  return 1;
+}
+
+int testDynGraph(TGraphL **gl, float score) {
+  TGraphD *gd = createGraphDyn((*gl)->nn);
+  ASSERT(gd != NULL, "DynGraph-01");
+
+  for (int u = 0; u < (*gl)->nn; u++) {
+    for (TNode *nod = (*gl)->adl[u]; nod; nod = nod->next) {
+      if (u < nod->v)
+        addEdgeDyn(gd, u, nod->v);
+    }
+  }
+  addEdgeDyn(gd, 2, 2);
+  ASSERT(gd->deg[1] == 4 && gd->deg[2] == 4, "DynGraph-02");
+  ASSERT(dynTwinsConsistent(gd), "DynGraph-03");
+
+  ASSERT(removeEdgeDyn(gd, 3, 1) == 1, "DynGraph-04");
+  ASSERT(removeEdgeDyn(gd, 3, 1) == 0, "DynGraph-05");
+  ASSERT(gd->deg[1] == 3 && gd->deg[3] == 2, "DynGraph-06");
+  ASSERT(dynTwinsConsistent(gd), "DynGraph-07");
+
+  removeNodeDyn(gd, 2);
+  ASSERT(gd->deg[2] == 0 && gd->deg[1] == 2 && gd->deg[3] == 1, "DynGraph-08");
+  ASSERT(dynTwinsConsistent(gd), "DynGraph-09");
+
+  removeNodeDyn(gd, 4);
+  ASSERT(gd->deg[0] == 1 && gd->deg[5] == 1 && gd->deg[3] == 0, "DynGraph-10");
+  ASSERT(dynTwinsConsistent(gd), "DynGraph-11");
+
+  destroyGraphDyn(gd);
+  passed3("Dynamic Graph", score);
+  return 1;
+}
+
+int testSharedFormats(TGraphL **gl, float score) {
+  // Directed, weighted: 0->1 (5), 0->2 (7), 2->1 (-3)
+  int src[] = {0, 0, 2}, dst[] = {1, 2, 1}, cost[] = {5, 7, -3};
+  EdgeList el = {.nn = 3, .ne = 3, .directed = 1, .weighted = 1,
+                 .src = src, .dst = dst, .cost = cost};
+
+  TGraphL *g = createGraphFromEdgeList(&el);
+  ASSERT(g != NULL, "SharedFormats-01");
+  ASSERT(g->adl[0]->v == 2 && g->adl[0]->c == 7, "SharedFormats-02");
+  ASSERT(g->adl[0]->next->v == 1 && g->adl[0]->next->c == 5,
+         "SharedFormats-03");
+  ASSERT(g->adl[1] == NULL && g->adl[2]->c == -3, "SharedFormats-04");
+
+  CsrGraph *csr = graphToCsr(g, 1);
+  destroyGraphAdjList(g);
+  ASSERT(csr != NULL && csr->directed && csr->na == 3, "SharedFormats-05");
+  int ok = csr->off[1] == 2 && csr->off[2] == 2 && csr->adj[0] == 2 &&
+           csr->cost[0] == 7 && csr->adj[2] == 1 && csr->cost[2] == -3;
+  freeCsr(csr);
+  ASSERT(ok, "SharedFormats-06");
+
+  // Undirected test graph: every edge appears in both directions
+  csr = graphToCsr(*gl, 0);
+  ASSERT(csr != NULL, "SharedFormats-07");
+  ok = 1;
+  for (int u = 0; u < csr->nn; u++) {
+    long k = csr->off[u];
+    for (TNode *nod = (*gl)->adl[u]; nod; nod = nod->next, k++)
+      ok &= k < csr->off[u + 1] && csr->adj[k] == nod->v && csr->cost[k] == 0;
+  }
+  freeCsr(csr);
+  ASSERT(ok, "SharedFormats-08");
+
+  passed2("Shared Formats", score);
+  return 1;
+}
+
+int testMsBfs(TGraphL **gl, float score) {
+  CsrGraph *csr = graphToCsr(*gl, 0);
+  ASSERT(csr != NULL, "MsBfs-01");
+
+  int n = csr->nn, sources[] = {0, 5, 2, 0};
+  int k = sizeof(sources) / sizeof(int);
+  int *dist = (int *)malloc((size_t)k * n * sizeof(int));
+  uint64_t *reach = (uint64_t *)malloc((size_t)n * sizeof(uint64_t));
+  int ok = dist && reach && msBfsDistances(csr, sources, k, dist) == 0 &&
+           msBfsReachability(csr, sources, k, reach) == 0;
+
+  // BFS distances: 0 at the source, arcs change them by at most one, and
+  // every other reached vertex has a neighbour one level closer
+  for (int i = 0; ok && i < k; i++) {
+    int *d = dist + (long)i * n;
+    ok &= d[sources[i]] == 0;
+    for (int u = 0; u < n; u++) {
+      int closer = u == sources[i];
+      for (long a = csr->off[u]; a < csr->off[u + 1]; a++) {
+        int v = csr->adj[a];
+        ok &= (d[u] < 0) == (d[v] < 0);
+        ok &= d[u] < 0 || (d[v] >= d[u] - 1 && d[v] <= d[u] + 1);
+        closer |= d[u] > 0 && d[v] == d[u] - 1;
+      }
+      ok &= d[u] < 0 || closer;
+      ok &= (d[u] >= 0) == (int)((reach[u] >> i) & 1);
+    }
+  }
+
+  free(dist);
+  free(reach);
+  freeCsr(csr);
+  ASSERT(ok, "MsBfs-02");
+
+  passed3("Multi-source BFS", score);
+  return 1;
+}
+
 typedef struct Test {
   int (*testFunction)(TGraphL **gl, float);
   float score;
@@ -129,6 +283,10 @@ int main(int argc, char *argv[]) {
                   {&testAddEdges, 0.5},
                   {&testDFS, 4},
                   {&testBFS, 4},
+                  {&testComponents, 1},
+                  {&testDynGraph, 1},
+                  {&testSharedFormats, 1},
+                  {&testMsBfs, 1},
                   {&testDestroy, 0.5}};
 
   float totalScore = 0.0f, maxScore = 0.0f;
@@ -146,8 +304,6 @@ int main(int argc, char *argv[]) {
 
     if ((tests[testIdx].testFunction) == testDestroy) {
       gl = NULL;
-      fclose(stdin);
-      freopen("graph.in", "r", stdin);
       buildGraphsFromFile(&gl);
     }
   }
@@ -164,26 +320,23 @@ void buildGraphsFromFile(TGraphL **gl) {
     *gl = NULL;
   }
 
-  int numOfVertices, numOfEdges;
-  int v1, v2;
-  if (scanf("%d %d", &numOfVertices, &numOfEdges) != 2) {
-    fprintf(stderr, "Error reading graph dimensions.\n");
+  EdgeList *el = loadEdgeList("../data/graph.in", GRAPHIO_PLAIN);
+  if (!el) {
+    fprintf(stderr, "Error loading graph.\n");
     return;
   }
 
-  *gl = createGraphAdjList(numOfVertices);
+  *gl = createGraphAdjList(el->nn);
   if (!*gl) {
     fprintf(stderr, "Error creating graph.\n");
+    freeEdgeList(el);
     return;
   }
 
-  for (int i = 0; i < numOfEdges; i++) {
-    if (scanf("%d %d", &v1, &v2) != 2) {
-      fprintf(stderr, "Error reading edges.\n");
-      return;
-    }
-    addEdgeList(*gl, v1, v2);
+  for (long i = 0; i < el->ne; i++) {
+    addEdgeList(*gl, el->src[i], el->dst[i]);
   }
+  freeEdgeList(el);
 }
 
 void printPath(List *path) {
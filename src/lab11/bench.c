@@ -0,0 +1,281 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "include/contraction.h"
+#include "include/deltastep.h"
+#include "include/graph.h"
+#include "include/pathsearch.h"
+
+/*
+ * Benchmarks `dijkstra_queue` with every priority queue on a road-like
+ * graph: a side x side grid with random costs in [1, maxCost] where a few
+ * streets are missing and a few diagonal shortcuts exist.
+ *
+ * The contraction hierarchy is built on a separate chSide x chSide grid,
+ * since its preprocessing dominates the run time on large grids.
+ *
+ * Usage: bench [side] [maxCost] [queries] [chSide]
+ */
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 7;
+  rngState ^= rngState << 17;
+  return (unsigned)(rngState >> 32);
+}
+
+static double nowMs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static void buildRoadGraph(TGraphL *G, int side, int maxCost) {
+  alloc_list(G, side * side);
+
+  for (int r = 0; r < side; r++) {
+    for (int c = 0; c < side; c++) {
+      int u = r * side + c;
+      if (c + 1 < side && rng() % 10)
+        insert_edge_list(G, u, u + 1, 1 + rng() % maxCost);
+      if (r + 1 < side && rng() % 10)
+        insert_edge_list(G, u, u + side, 1 + rng() % maxCost);
+      if (r + 1 < side && c + 1 < side && rng() % 20 == 0)
+        insert_edge_list(G, u, u + side + 1, 1 + rng() % maxCost);
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  int side = argc > 1 ? atoi(argv[1]) : 700;
+  int maxCost = argc > 2 ? atoi(argv[2]) : 100;
+  int queries = argc > 3 ? atoi(argv[3]) : 5;
+  int chSide = argc > 4 ? atoi(argv[4]) : 200;
+  if (side <= 0 || maxCost <= 0 || queries <= 0 || chSide <= 0) {
+    fprintf(stderr, "Usage: %s [side] [maxCost] [queries] [chSide]\n",
+            argv[0]);
+    return 1;
+  }
+
+  TGraphL G;
+  buildRoadGraph(&G, side, maxCost);
+
+  const char *names[] = {"binary-heap", "dial", "radix-heap"};
+  QueueType types[] = {QUEUE_BINARY_HEAP, QUEUE_DIAL, QUEUE_RADIX_HEAP};
+  int *ref = (int *)malloc(G.nn * sizeof(int));
+  int *dist = (int *)malloc(G.nn * sizeof(int));
+  int *sources = (int *)malloc(queries * sizeof(int));
+  if (!ref || !dist || !sources) {
+    fprintf(stderr, "Memory allocation failed for benchmark buffers.\n");
+    return 1;
+  }
+  for (int q = 0; q < queries; q++)
+    sources[q] = rng() % G.nn;
+
+  printf("grid %dx%d, %d vertices, costs 1..%d, %d queries\n", side, side,
+         G.nn, maxCost, queries);
+  printf("%-12s %12s\n", "queue", "ms/query");
+
+  int ok = 1;
+  for (int t = 0; t < 3; t++) {
+    double total = 0;
+    for (int q = 0; q < queries; q++) {
+      double t0 = nowMs();
+      ok &= dijkstra_queue(&G, sources[q], types[t], dist) == 0;
+      total += nowMs() - t0;
+
+      ok &= dijkstra_queue(&G, sources[q], QUEUE_BINARY_HEAP, ref) == 0;
+      if (memcmp(ref, dist, G.nn * sizeof(int)) != 0)
+        ok = 0;
+    }
+    printf("%-12s %12.3f\n", names[t], total / queries);
+  }
+
+  // Delta-stepping: delta sweep at full width, then thread scaling
+  CsrGraph *csr = graph_to_csr(&G);
+  if (!csr)
+    return 1;
+
+#ifdef _OPENMP
+  int maxThreads = omp_get_max_threads();
+#else
+  int maxThreads = 1;
+#endif
+  int deltas[] = {maxCost / 4 > 0 ? maxCost / 4 : 1, maxCost, 4 * maxCost};
+  int bestDelta = deltas[0];
+  double bestMs = -1;
+
+  printf("\n%-12s %8s %8s %12s\n", "sssp", "delta", "threads", "ms/query");
+  for (int d = 0; d < 3; d++) {
+    double total = 0;
+    for (int q = 0; q < queries; q++) {
+      double t0 = nowMs();
+      ok &= delta_stepping(csr, sources[q], deltas[d], dist) == 0;
+      total += nowMs() - t0;
+
+      ok &= dijkstra_queue(&G, sources[q], QUEUE_BINARY_HEAP, ref) == 0;
+      if (memcmp(ref, dist, G.nn * sizeof(int)) != 0)
+        ok = 0;
+    }
+    printf("%-12s %8d %8d %12.3f\n", "delta-step", deltas[d], maxThreads,
+           total / queries);
+    if (bestMs < 0 || total < bestMs) {
+      bestMs = total;
+      bestDelta = deltas[d];
+    }
+  }
+
+#ifdef _OPENMP
+  // Doubling thread counts, always ending with the maximum
+  for (int threads = 1;; threads = threads * 2 < maxThreads ? threads * 2
+                                                            : maxThreads) {
+    omp_set_num_threads(threads);
+    double total = 0;
+    for (int q = 0; q < queries; q++) {
+      double t0 = nowMs();
+      delta_stepping(csr, sources[q], bestDelta, dist);
+      total += nowMs() - t0;
+    }
+    printf("%-12s %8d %8d %12.3f\n", "delta-step", bestDelta, threads,
+           total / queries);
+    if (threads == maxThreads)
+      break;
+  }
+  omp_set_num_threads(maxThreads);
+#endif
+  freeCsr(csr);
+
+  // Reused workspace: full queries, then point-to-point with early exit
+  SPWorkspace *ws = sp_workspace_create(G.nn);
+  if (!ws)
+    return 1;
+
+  double full = 0, p2p = 0;
+  long settled = 0;
+  for (int q = 0; q < queries; q++) {
+    int t = rng() % G.nn;
+    double t0 = nowMs();
+    sp_query(&G, sources[q], -1, ws);
+    full += nowMs() - t0;
+
+    ok &= dijkstra_queue(&G, sources[q], QUEUE_BINARY_HEAP, ref) == 0;
+    sp_export(ws, dist, NULL);
+    if (memcmp(ref, dist, G.nn * sizeof(int)) != 0)
+      ok = 0;
+
+    t0 = nowMs();
+    int d = sp_query(&G, sources[q], t, ws);
+    p2p += nowMs() - t0;
+    settled += ws->settled;
+    if (d != ref[t])
+      ok = 0;
+  }
+  printf("%-12s %12.3f\n", "workspace", full / queries);
+  printf("%-12s %12.3f  (%.0f settled on average)\n", "early-exit",
+         p2p / queries, (double)settled / queries);
+
+  // Point-to-point searches on the same random pairs
+  SPWorkspace *bwd = sp_workspace_create(G.nn);
+  double t0 = nowMs();
+  ALTLandmarks *alt = alt_build(&G, 8);
+  double altMs = nowMs() - t0;
+  if (!bwd || !alt)
+    return 1;
+
+  const char *p2pNames[] = {"dijkstra", "bidirectional", "astar-alt"};
+  printf("\n%-14s %12s %12s   (ALT preprocessing %.1f ms)\n", "p2p search",
+         "ms/query", "settled", altMs);
+  for (int a = 0; a < 3; a++) {
+    double total = 0;
+    long count = 0;
+    rngState = 2463534242ULL;
+    for (int q = 0; q < queries; q++) {
+      int s = rng() % G.nn, t = rng() % G.nn, d, meet;
+      int expected = sp_query(&G, s, t, ws);
+
+      t0 = nowMs();
+      if (a == 0) {
+        d = sp_query(&G, s, t, ws);
+        count += ws->settled;
+      } else if (a == 1) {
+        d = bidijkstra_query(&G, s, t, ws, bwd, &meet);
+        count += ws->settled + bwd->settled;
+      } else {
+        d = astar_query(&G, s, t, alt_heuristic, alt, ws);
+        count += ws->settled;
+      }
+      total += nowMs() - t0;
+      if (d != expected)
+        ok = 0;
+    }
+    printf("%-14s %12.3f %12.0f\n", p2pNames[a], total / queries,
+           (double)count / queries);
+  }
+
+  alt_free(alt);
+
+  // Contraction hierarchy: preprocess, round-trip through a file, query
+  TGraphL H;
+  buildRoadGraph(&H, chSide, maxCost);
+
+  long shortcuts = 0;
+  t0 = nowMs();
+  CHGraph *built = ch_build(&H, &shortcuts);
+  double chMs = nowMs() - t0;
+  if (!built || ch_save(built, "bench.ch") != 0)
+    return 1;
+  ch_free(built);
+
+  t0 = nowMs();
+  CHGraph *ch = ch_load("bench.ch");
+  double loadMs = nowMs() - t0;
+  if (!ch)
+    return 1;
+
+  int chQueries = queries * 200;
+  double chTotal = 0, dijTotal = 0;
+  long chSettled = 0;
+  for (int q = 0; q < chQueries; q++) {
+    int s = rng() % H.nn, t = rng() % H.nn;
+
+    t0 = nowMs();
+    int expected = sp_query(&H, s, t, ws);
+    dijTotal += nowMs() - t0;
+
+    t0 = nowMs();
+    int d = ch_query(ch, s, t, ws, bwd);
+    chTotal += nowMs() - t0;
+    chSettled += ws->settled + bwd->settled;
+    if (d != expected)
+      ok = 0;
+  }
+  printf("\ncontraction hierarchy on %dx%d grid: build %.1f ms, %ld shortcuts, "
+         "%ld upward arcs, load %.1f ms\n",
+         chSide, chSide, chMs, shortcuts, ch->na, loadMs);
+  printf("%-14s %12.1f us/query\n", "dijkstra", 1e3 * dijTotal / chQueries);
+  printf("%-14s %12.1f us/query %8.0f settled  (%d pairs)\n", "ch-query",
+         1e3 * chTotal / chQueries, (double)chSettled / chQueries,
+         chQueries);
+  ch_free(ch);
+  destroyGraphAdjList(&H);
+  sp_workspace_free(bwd);
+  sp_workspace_free(ws);
+
+  printf("distances %s\n", ok ? "match" : "DIFFER");
+
+  free(ref);
+  free(dist);
+  free(sources);
+  destroyGraphAdjList(&G);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/bucketqueue.h"
+
+ABucketQueue makeBucketQueue(int capacity, int maxCost) {
+  if (capacity <= 0 || maxCost < 0) {
+    fprintf(stderr, "Error: Invalid bucket queue parameters.\n");
+    return NULL;
+  }
+
+  ABucketQueue q = (ABucketQueue)malloc(sizeof(BucketQueue));
+  if (!q) {
+    fprintf(stderr, "Error: Memory allocation failed for bucket queue.\n");
+    return NULL;
+  }
+
+  q->capacity = capacity;
+  q->size = 0;
+  q->nb = maxCost + 1;
+  q->cur = 0;
+  q->head = (int *)malloc(q->nb * sizeof(int));
+  q->next = (int *)malloc(capacity * sizeof(int));
+  q->prev = (int *)malloc(capacity * sizeof(int));
+  q->key = (int *)malloc(capacity * sizeof(int));
+  if (!q->head || !q->next || !q->prev || !q->key) {
+    fprintf(stderr, "Error: Memory allocation failed for buckets.\n");
+    freeBucketQueue(q);
+    return NULL;
+  }
+
+  for (int b = 0; b < q->nb; b++)
+    q->head[b] = -1;
+  for (int i = 0; i < capacity; i++)
+    q->key[i] = -1;
+
+  return q;
+}
+
+static void linkBucket(ABucketQueue q, int id) {
+  int b = q->key[id] % q->nb;
+  q->prev[id] = -1;
+  q->next[id] = q->head[b];
+  if (q->head[b] >= 0)
+    q->prev[q->head[b]] = id;
+  q->head[b] = id;
+}
+
+static void unlinkBucket(ABucketQueue q, int id) {
+  if (q->prev[id] >= 0)
+    q->next[q->prev[id]] = q->next[id];
+  else
+    q->head[q->key[id] % q->nb] = q->next[id];
+  if (q->next[id] >= 0)
+    q->prev[q->next[id]] = q->prev[id];
+}
+
+void insertBucket(ABucketQueue q, int id, int key) {
+  if (!q || id < 0 || id >= q->capacity || q->key[id] >= 0 || key < q->cur ||
+      key > q->cur + q->nb - 1) {
+    fprintf(stderr, "Error: Invalid insert into bucket queue.\n");
+    return;
+  }
+
+  q->key[id] = key;
+  linkBucket(q, id);
+  q->size++;
+}
+
+void decreaseKeyBucket(ABucketQueue q, int id, int key) {
+  if (!q || id < 0 || id >= q->capacity || q->key[id] < 0 ||
+      key >= q->key[id] || key < q->cur)
+    return;
+
+  unlinkBucket(q, id);
+  q->key[id] = key;
+  linkBucket(q, id);
+}
+
+int removeMinBucket(ABucketQueue q, int *key) {
+  if (!q || q->size == 0) {
+    fprintf(stderr, "Error: Cannot remove from empty bucket queue.\n");
+    return -1;
+  }
+
+  while (q->head[q->cur % q->nb] < 0)
+    q->cur++;
+
+  int id = q->head[q->cur % q->nb];
+  unlinkBucket(q, id);
+  if (key)
+    *key = q->key[id];
+  q->key[id] = -1;
+  q->size--;
+
+  return id;
+}
+
+void freeBucketQueue(ABucketQueue q) {
+  if (!q)
+    return;
+  free(q->head);
+  free(q->next);
+  free(q->prev);
+  free(q->key);
+  free(q);
+}
@@ -0,0 +1,492 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "include/contraction.h"
+#include "include/minheap.h"
+
+#define CH_MAGIC "SDACHIER"
+#define CH_VERSION 1
+
+/* Arc of the graph that remains while contracting. */
+typedef struct {
+  int v;
+  int c;
+} CHArc;
+
+typedef struct {
+  int deg;
+  int cap;
+  CHArc *arcs;
+} CHList;
+
+/**
+ * Preprocessing state.
+ * - `rem`: adjacency of the remaining (uncontracted) graph, shortcuts
+ *   included; arcs to contracted vertices are removed eagerly.
+ * - `up`: upward arcs recorded when each vertex was contracted.
+ * - `deleted`: number of already contracted neighbours of every vertex.
+ * - `ws`: workspace of the witness searches.
+ * - `target`, `mark`: `target[w] == mark` flags the vertices a witness
+ *   search still has to settle.
+ * - `nbr`, `nbrCost`, `touched`: scratch buffers of `nn` entries.
+ */
+typedef struct {
+  int nn;
+  CHList *rem;
+  CHList *up;
+  int *deleted;
+  SPWorkspace *ws;
+  unsigned *target;
+  unsigned mark;
+  int *nbr;
+  int *nbrCost;
+  int *touched;
+  long shortcuts;
+} CHBuilder;
+
+// ---------------------- Arc Lists ----------------------
+static int list_push(CHList *l, int v, int c) {
+  if (l->deg == l->cap) {
+    int cap = l->cap ? 2 * l->cap : 4;
+    CHArc *arcs = (CHArc *)realloc(l->arcs, cap * sizeof(CHArc));
+    if (!arcs) {
+      fprintf(stderr, "Memory allocation failed for hierarchy arcs.\n");
+      return 0;
+    }
+    l->arcs = arcs;
+    l->cap = cap;
+  }
+  l->arcs[l->deg++] = (CHArc){v, c};
+  return 1;
+}
+
+static int list_find(const CHList *l, int v) {
+  for (int i = 0; i < l->deg; i++)
+    if (l->arcs[i].v == v)
+      return i;
+  return -1;
+}
+
+static void list_remove(CHList *l, int v) {
+  int i = list_find(l, v);
+  if (i >= 0)
+    l->arcs[i] = l->arcs[--l->deg];
+}
+
+/* Adds the undirected arc (u, w) to the remaining graph, or lowers its cost. */
+static int add_or_lower(CHBuilder *b, int u, int w, int c) {
+  int i = list_find(&b->rem[u], w);
+  if (i < 0)
+    return list_push(&b->rem[u], w, c) && list_push(&b->rem[w], u, c);
+
+  if (c < b->rem[u].arcs[i].c) {
+    b->rem[u].arcs[i].c = c;
+    b->rem[w].arcs[list_find(&b->rem[w], u)].c = c;
+  }
+  return 1;
+}
+
+// ---------------------- Contraction ----------------------
+/**
+ * Local Dijkstra from `u` in the remaining graph, avoiding `x`. Stops past
+ * `maxDist`, after `CH_WITNESS_LIMIT` settled vertices, or once all
+ * `targets` flagged vertices are settled.
+ */
+static void witness_search(CHBuilder *b, int u, int x, int maxDist,
+                           int targets) {
+  SPWorkspace *ws = b->ws;
+  sp_begin(ws);
+  ws->seen[u] = ws->stamp;
+  ws->dist[u] = 0;
+  insertIndexed(ws->heap, u, 0);
+
+  int settled = 0;
+  while (ws->heap->size > 0) {
+    ItemType min = removeMinIndexed(ws->heap);
+    if (min.prior > maxDist || ++settled > CH_WITNESS_LIMIT)
+      break;
+    if (b->target[min.content] == b->mark && --targets == 0)
+      break;
+
+    CHList *l = &b->rem[min.content];
+    for (int i = 0; i < l->deg; i++) {
+      int v = l->arcs[i].v;
+      int nd = min.prior + l->arcs[i].c;
+      if (v == x)
+        continue;
+
+      if (ws->seen[v] != ws->stamp) {
+        ws->seen[v] = ws->stamp;
+        ws->dist[v] = nd;
+        insertIndexed(ws->heap, v, nd);
+      } else if (nd < ws->dist[v]) {
+        ws->dist[v] = nd;
+        decreaseKey(ws->heap, v, nd);
+      }
+    }
+  }
+
+  clearIndexedQueue(ws->heap);
+}
+
+/**
+ * Counts (and unless `simulate`, inserts) the shortcuts needed to contract
+ * `v`. Each neighbour pair is examined once; a shortcut is needed when no
+ * witness path avoiding `v` is at least as short as the path through it.
+ */
+static int contract(CHBuilder *b, int v, int simulate) {
+  CHList *l = &b->rem[v];
+  int n = l->deg, added = 0;
+
+  for (int i = 0; i < n; i++) {
+    b->nbr[i] = l->arcs[i].v;
+    b->nbrCost[i] = l->arcs[i].c;
+  }
+
+  for (int i = 0; i + 1 < n; i++) {
+    int maxDist = 0;
+    b->mark++;
+    for (int j = i + 1; j < n; j++) {
+      b->target[b->nbr[j]] = b->mark;
+      if (b->nbrCost[i] + b->nbrCost[j] > maxDist)
+        maxDist = b->nbrCost[i] + b->nbrCost[j];
+    }
+
+    witness_search(b, b->nbr[i], v, maxDist, n - i - 1);
+
+    for (int j = i + 1; j < n; j++) {
+      int via = b->nbrCost[i] + b->nbrCost[j];
+      if (sp_dist(b->ws, b->nbr[j]) <= via)
+        continue;
+
+      added++;
+      if (!simulate && !add_or_lower(b, b->nbr[i], b->nbr[j], via))
+        return -1;
+    }
+  }
+
+  return added;
+}
+
+/* Edge difference plus contracted neighbours: small values go first. */
+static int priority(CHBuilder *b, int v) {
+  return contract(b, v, 1) - b->rem[v].deg + b->deleted[v];
+}
+
+static void builder_free(CHBuilder *b) {
+  if (b->rem)
+    for (int v = 0; v < b->nn; v++)
+      free(b->rem[v].arcs);
+  if (b->up)
+    for (int v = 0; v < b->nn; v++)
+      free(b->up[v].arcs);
+  free(b->rem);
+  free(b->up);
+  free(b->deleted);
+  free(b->target);
+  free(b->nbr);
+  free(b->nbrCost);
+  free(b->touched);
+  sp_workspace_free(b->ws);
+}
+
+static CHGraph *ch_alloc(int nn, long na) {
+  CHGraph *ch = (CHGraph *)calloc(1, sizeof(CHGraph));
+  if (!ch)
+    return NULL;
+
+  ch->nn = nn;
+  ch->na = na;
+  ch->rank = (int *)malloc((nn > 0 ? nn : 1) * sizeof(int));
+  ch->off = (long *)malloc(((size_t)nn + 1) * sizeof(long));
+  ch->head = (int *)malloc((na > 0 ? na : 1) * sizeof(int));
+  ch->cost = (int *)malloc((na > 0 ? na : 1) * sizeof(int));
+  if (!ch->rank || !ch->off || !ch->head || !ch->cost) {
+    ch_free(ch);
+    return NULL;
+  }
+  return ch;
+}
+
+CHGraph *ch_build(const TGraphL *G, long *shortcuts) {
+  if (!G || G->nn <= 0)
+    return NULL;
+
+  int n = G->nn;
+  CHBuilder b = {n};
+  b.rem = (CHList *)calloc(n, sizeof(CHList));
+  b.up = (CHList *)calloc(n, sizeof(CHList));
+  b.deleted = (int *)calloc(n, sizeof(int));
+  b.target = (unsigned *)calloc(n, sizeof(unsigned));
+  b.nbr = (int *)malloc(n * sizeof(int));
+  b.nbrCost = (int *)malloc(n * sizeof(int));
+  b.touched = (int *)malloc(n * sizeof(int));
+  b.ws = sp_workspace_create(n);
+  int *rank = (int *)malloc(n * sizeof(int));
+  AIndexedPriQueue order = makeIndexedQueue(n);
+
+  CHGraph *ch = NULL;
+  if (!b.rem || !b.up || !b.deleted || !b.target || !b.nbr || !b.nbrCost ||
+      !b.touched || !b.ws || !rank || !order) {
+    fprintf(stderr, "Memory allocation failed for hierarchy builder.\n");
+    goto done;
+  }
+
+  // Copy the graph, dropping self-loops and keeping the cheapest parallel arc
+  for (int u = 0; u < n; u++)
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next)
+      if (nod->v > u && !add_or_lower(&b, u, nod->v, nod->c))
+        goto done;
+
+  for (int v = 0; v < n; v++)
+    insertIndexed(order, v, priority(&b, v));
+
+  for (int next = 0; order->size > 0;) {
+    int v = removeMinIndexed(order).content;
+
+    // Lazy update: re-queue if the priority got worse than the next best
+    int p = priority(&b, v);
+    if (order->size > 0 && p > getMinIndexed(order).prior) {
+      insertIndexed(order, v, p);
+      continue;
+    }
+
+    rank[v] = next++;
+    CHList *l = &b.rem[v];
+    int deg = l->deg;
+    for (int i = 0; i < deg; i++) {
+      b.touched[i] = l->arcs[i].v;
+      if (!list_push(&b.up[v], l->arcs[i].v, l->arcs[i].c))
+        goto done;
+    }
+
+    int added = contract(&b, v, 0);
+    if (added < 0)
+      goto done;
+    b.shortcuts += added;
+
+    for (int i = 0; i < deg; i++) {
+      list_remove(&b.rem[b.touched[i]], v);
+      b.deleted[b.touched[i]]++;
+    }
+    free(l->arcs);
+    *l = (CHList){0, 0, NULL};
+
+    for (int i = 0; i < deg; i++)
+      changeKey(order, b.touched[i], priority(&b, b.touched[i]));
+  }
+
+  long na = 0;
+  for (int v = 0; v < n; v++)
+    na += b.up[v].deg;
+
+  ch = ch_alloc(n, na);
+  if (!ch) {
+    fprintf(stderr, "Memory allocation failed for hierarchy.\n");
+    goto done;
+  }
+
+  memcpy(ch->rank, rank, n * sizeof(int));
+  ch->off[0] = 0;
+  for (int v = 0; v < n; v++) {
+    long k = ch->off[v];
+    for (int i = 0; i < b.up[v].deg; i++, k++) {
+      ch->head[k] = b.up[v].arcs[i].v;
+      ch->cost[k] = b.up[v].arcs[i].c;
+    }
+    ch->off[v + 1] = k;
+  }
+
+  if (shortcuts)
+    *shortcuts = b.shortcuts;
+
+done:
+  free(rank);
+  freeIndexedQueue(order);
+  builder_free(&b);
+  return ch;
+}
+
+// ---------------------- Query ----------------------
+/* Settles one vertex of an upward search, updating the best meeting. */
+static void ch_step(const CHGraph *ch, SPWorkspace *ws,
+                    const SPWorkspace *other, int *best) {
+  int u = removeMinIndexed(ws->heap).content;
+  ws->settled++;
+
+  if (other->seen[u] == other->stamp && ws->dist[u] + other->dist[u] < *best)
+    *best = ws->dist[u] + other->dist[u];
+
+  for (long k = ch->off[u]; k < ch->off[u + 1]; k++) {
+    int v = ch->head[k];
+    int nd = ws->dist[u] + ch->cost[k];
+
+    if (ws->seen[v] != ws->stamp) {
+      ws->seen[v] = ws->stamp;
+      ws->dist[v] = nd;
+      ws->pred[v] = u;
+      insertIndexed(ws->heap, v, nd);
+    } else if (nd < ws->dist[v]) {
+      ws->dist[v] = nd;
+      ws->pred[v] = u;
+      decreaseKey(ws->heap, v, nd);
+    }
+  }
+}
+
+static int ch_done(const SPWorkspace *ws, int best) {
+  return ws->heap->size == 0 || getMinIndexed(ws->heap).prior >= best;
+}
+
+int ch_query(const CHGraph *ch, int s, int t, SPWorkspace *fwd,
+             SPWorkspace *bwd) {
+  if (!ch || !fwd || !bwd || ch->nn > fwd->nn || ch->nn > bwd->nn || s < 0 ||
+      t < 0 || s >= ch->nn || t >= ch->nn)
+    return INF;
+
+  SPWorkspace *side[2] = {fwd, bwd};
+  int root[2] = {s, t};
+  for (int d = 0; d < 2; d++) {
+    SPWorkspace *ws = side[d];
+    sp_begin(ws);
+    ws->source = root[d];
+    ws->settled = 0;
+    ws->seen[root[d]] = ws->stamp;
+    ws->dist[root[d]] = 0;
+    ws->pred[root[d]] = -1;
+    insertIndexed(ws->heap, root[d], 0);
+  }
+
+  int best = INF;
+  for (int turn = 0;; turn ^= 1) {
+    int doneF = ch_done(fwd, best), doneB = ch_done(bwd, best);
+    if (doneF && doneB)
+      break;
+
+    if (doneB || (!doneF && turn == 0))
+      ch_step(ch, fwd, bwd, &best);
+    else
+      ch_step(ch, bwd, fwd, &best);
+  }
+
+  clearIndexedQueue(fwd->heap);
+  clearIndexedQueue(bwd->heap);
+  return best;
+}
+
+// ---------------------- Serialization ----------------------
+typedef struct {
+  char magic[8];
+  int32_t version;
+  int32_t nn;
+  int64_t na;
+} CHFileHeader;
+
+/* Offsets are stored as int64_t whatever the size of `long`. */
+static int write_offsets(const long *off, size_t count, FILE *out) {
+  int64_t *buf = (int64_t *)malloc(count * sizeof(int64_t));
+  if (!buf)
+    return 0;
+  for (size_t i = 0; i < count; i++)
+    buf[i] = off[i];
+  int ok = fwrite(buf, sizeof(int64_t), count, out) == count;
+  free(buf);
+  return ok;
+}
+
+/* Reads `count` offsets, which must rise from 0 to `na`. */
+static int read_offsets(long *off, size_t count, int64_t na, FILE *in) {
+  int64_t *buf = (int64_t *)malloc(count * sizeof(int64_t));
+  if (!buf)
+    return 0;
+
+  int ok = fread(buf, sizeof(int64_t), count, in) == count && buf[0] == 0 &&
+           buf[count - 1] == na;
+  for (size_t i = 1; ok && i < count; i++)
+    ok = buf[i] >= buf[i - 1];
+  for (size_t i = 0; ok && i < count; i++)
+    off[i] = (long)buf[i];
+
+  free(buf);
+  return ok;
+}
+
+int ch_save(const CHGraph *ch, const char *path) {
+  if (!ch || !path)
+    return -1;
+
+  FILE *out = fopen(path, "wb");
+  if (!out) {
+    fprintf(stderr, "Error: Could not open file for writing: %s\n", path);
+    return -1;
+  }
+
+  CHFileHeader h;
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, CH_MAGIC, sizeof(h.magic));
+  h.version = CH_VERSION;
+  h.nn = ch->nn;
+  h.na = ch->na;
+
+  size_t nn = (size_t)ch->nn, na = (size_t)ch->na;
+  int ok = fwrite(&h, sizeof(h), 1, out) == 1 &&
+           fwrite(ch->rank, sizeof(int), nn, out) == nn &&
+           write_offsets(ch->off, nn + 1, out) &&
+           fwrite(ch->head, sizeof(int), na, out) == na &&
+           fwrite(ch->cost, sizeof(int), na, out) == na;
+
+  if (fclose(out) != 0)
+    ok = 0;
+  if (!ok)
+    fprintf(stderr, "Error: Failed writing hierarchy file: %s\n", path);
+  return ok ? 0 : -1;
+}
+
+CHGraph *ch_load(const char *path) {
+  FILE *in = path ? fopen(path, "rb") : NULL;
+  if (!in) {
+    fprintf(stderr, "Error: Unable to open hierarchy file: %s\n", path);
+    return NULL;
+  }
+
+  CHFileHeader h;
+  CHGraph *ch = NULL;
+  if (fread(&h, sizeof(h), 1, in) != 1 ||
+      memcmp(h.magic, CH_MAGIC, sizeof(h.magic)) != 0 ||
+      h.version != CH_VERSION || h.nn <= 0 || h.na < 0 ||
+      !(ch = ch_alloc(h.nn, (long)h.na))) {
+    fprintf(stderr, "Error: Invalid hierarchy file: %s\n", path);
+    fclose(in);
+    return NULL;
+  }
+
+  size_t nn = (size_t)ch->nn, na = (size_t)ch->na;
+  int ok = fread(ch->rank, sizeof(int), nn, in) == nn &&
+           read_offsets(ch->off, nn + 1, h.na, in) &&
+           fread(ch->head, sizeof(int), na, in) == na &&
+           fread(ch->cost, sizeof(int), na, in) == na;
+  fclose(in);
+
+  for (long k = 0; ok && k < ch->na; k++)
+    if (ch->head[k] < 0 || ch->head[k] >= ch->nn)
+      ok = 0;
+
+  if (!ok) {
+    fprintf(stderr, "Error: Corrupt hierarchy file: %s\n", path);
+    ch_free(ch);
+    return NULL;
+  }
+  return ch;
+}
+
+void ch_free(CHGraph *ch) {
+  if (!ch)
+    return;
+  free(ch->rank);
+  free(ch->off);
+  free(ch->head);
+  free(ch->cost);
+  free(ch);
+}
@@ -0,0 +1,288 @@
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "include/deltastep.h"
+
+/* Growable array of vertex ids. */
+typedef struct {
+  int *v;
+  long n;
+  long cap;
+} IntVec;
+
+/*
+ * Buckets owned by a single thread, indexed by `dist / delta`, and the
+ * vertices it removed from the current bucket (their heavy arcs are relaxed
+ * once the bucket stays empty).
+ */
+typedef struct {
+  IntVec *bins;
+  long nb;
+  IntVec settled;
+  int failed;
+} LocalBins;
+
+static int vec_reserve(IntVec *vec, long n) {
+  if (n <= vec->cap)
+    return 1;
+
+  long cap = vec->cap ? vec->cap : 64;
+  while (cap < n)
+    cap *= 2;
+  int *data = (int *)realloc(vec->v, cap * sizeof(int));
+  if (!data)
+    return 0;
+  vec->v = data;
+  vec->cap = cap;
+  return 1;
+}
+
+static int vec_push(IntVec *vec, int v) {
+  if (!vec_reserve(vec, vec->n + 1))
+    return 0;
+  vec->v[vec->n++] = v;
+  return 1;
+}
+
+static int bins_push(LocalBins *lb, long b, int v) {
+  if (b >= lb->nb) {
+    long nb = lb->nb ? lb->nb : 16;
+    while (nb <= b)
+      nb *= 2;
+    IntVec *bins = (IntVec *)realloc(lb->bins, nb * sizeof(IntVec));
+    if (!bins)
+      return 0;
+    memset(bins + lb->nb, 0, (nb - lb->nb) * sizeof(IntVec));
+    lb->bins = bins;
+    lb->nb = nb;
+  }
+  return vec_push(&lb->bins[b], v);
+}
+
+/* Lowers `*addr` to `val` atomically; returns 1 if `val` was smaller. */
+static int atomic_min(int *addr, int val) {
+  int old = __atomic_load_n(addr, __ATOMIC_RELAXED);
+  while (val < old) {
+    if (__atomic_compare_exchange_n(addr, &old, val, 1, __ATOMIC_RELAXED,
+                                    __ATOMIC_RELAXED))
+      return 1;
+  }
+  return 0;
+}
+
+/* Bucket `b` of `lb` (its settled vertices when `b < 0`), NULL if absent. */
+static IntVec *bin_of(LocalBins *lb, long b) {
+  if (b < 0)
+    return &lb->settled;
+  return b < lb->nb ? &lb->bins[b] : NULL;
+}
+
+/*
+ * Moves bucket `b` (or the settled vertices, `b < 0`) of every thread into
+ * `out`, emptying them. Returns the number of vertices moved, -1 on error.
+ */
+static long gather(LocalBins *lb, int threads, long b, long *offset,
+                   IntVec *out) {
+  offset[0] = 0;
+  for (int t = 0; t < threads; t++) {
+    IntVec *in = bin_of(&lb[t], b);
+    offset[t + 1] = offset[t] + (in ? in->n : 0);
+  }
+
+  if (!vec_reserve(out, offset[threads]))
+    return -1;
+
+#pragma omp parallel for
+  for (int t = 0; t < threads; t++) {
+    IntVec *in = bin_of(&lb[t], b);
+    if (in && in->n > 0) {
+      memcpy(out->v + offset[t], in->v, in->n * sizeof(int));
+      in->n = 0;
+    }
+  }
+  out->n = offset[threads];
+  return out->n;
+}
+
+CsrGraph *graph_to_csr(const TGraphL *G) {
+  if (!G)
+    return NULL;
+
+  CsrGraph *g = (CsrGraph *)calloc(1, sizeof(CsrGraph));
+  if (!g)
+    return NULL;
+
+  g->nn = G->nn;
+  g->off = (long *)calloc((size_t)G->nn + 1, sizeof(long));
+  if (!g->off) {
+    freeCsr(g);
+    return NULL;
+  }
+
+  for (int u = 0; u < G->nn; u++) {
+    long deg = 0;
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next)
+      deg++;
+    g->off[u + 1] = g->off[u] + deg;
+  }
+
+  g->na = g->off[G->nn];
+  g->adj = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  g->cost = (int *)malloc((g->na > 0 ? g->na : 1) * sizeof(int));
+  if (!g->adj || !g->cost) {
+    fprintf(stderr, "Memory allocation failed for CSR graph.\n");
+    freeCsr(g);
+    return NULL;
+  }
+
+  for (int u = 0; u < G->nn; u++) {
+    long k = g->off[u];
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next, k++) {
+      g->adj[k] = nod->v;
+      g->cost[k] = nod->c;
+    }
+  }
+
+  return g;
+}
+
+int delta_stepping(const CsrGraph *g, int s, int delta, int *dist) {
+  if (!g || !g->cost || !dist || s < 0 || s >= g->nn || delta <= 0)
+    return -1;
+
+#ifdef _OPENMP
+  int threads = omp_get_max_threads();
+#else
+  int threads = 1;
+#endif
+
+  LocalBins *lb = (LocalBins *)calloc(threads, sizeof(LocalBins));
+  long *offset = (long *)malloc(((size_t)threads + 1) * sizeof(long));
+  int *mark = (int *)calloc(g->nn, sizeof(int));
+  IntVec frontier = {NULL, 0, 0};
+  if (!lb || !offset || !mark || !bins_push(&lb[0], 0, s)) {
+    fprintf(stderr, "Memory allocation failed for delta-stepping.\n");
+    if (lb)
+      free(lb[0].bins);
+    free(lb);
+    free(offset);
+    free(mark);
+    return -1;
+  }
+
+  // INT_MAX marks unreached vertices while running, INF is reported after
+#pragma omp parallel for
+  for (int v = 0; v < g->nn; v++)
+    dist[v] = INT_MAX;
+  dist[s] = 0;
+
+  int failed = 0, phase = 0;
+  long curr = 0;
+  for (;;) {
+    // The next bucket is the lowest non-empty one at or after `curr`
+    long next = -1;
+    for (int t = 0; t < threads; t++) {
+      for (long b = curr; b < lb[t].nb && (next < 0 || b < next); b++) {
+        if (lb[t].bins[b].n > 0) {
+          next = b;
+          break;
+        }
+      }
+    }
+    if (next < 0)
+      break;
+    curr = next;
+    phase++;
+    long lower = curr * delta;
+
+    // Light arcs (cost <= delta) may refill the bucket: repeat until empty.
+    // Entries whose distance has since dropped below the bucket were already
+    // settled in an earlier one; `mark` records each vertex once per bucket.
+    long n;
+    while ((n = gather(lb, threads, curr, offset, &frontier)) > 0) {
+#pragma omp parallel for schedule(dynamic, 64)
+      for (long i = 0; i < n; i++) {
+#ifdef _OPENMP
+        LocalBins *mine = &lb[omp_get_thread_num()];
+#else
+        LocalBins *mine = &lb[0];
+#endif
+        int u = frontier.v[i];
+        int du = __atomic_load_n(&dist[u], __ATOMIC_RELAXED);
+        if (du < lower)
+          continue;
+        if (__atomic_exchange_n(&mark[u], phase, __ATOMIC_RELAXED) != phase &&
+            !vec_push(&mine->settled, u))
+          mine->failed = 1;
+
+        for (long k = g->off[u]; k < g->off[u + 1]; k++) {
+          if (g->cost[k] > delta)
+            continue;
+          int nd = du + g->cost[k];
+          if (atomic_min(&dist[g->adj[k]], nd) &&
+              !bins_push(mine, nd / delta, g->adj[k]))
+            mine->failed = 1;
+        }
+      }
+    }
+
+    // The bucket is final: relax the heavy arcs of its vertices once, they
+    // only reach later buckets
+    if (n == 0)
+      n = gather(lb, threads, -1, offset, &frontier);
+#pragma omp parallel for schedule(dynamic, 64)
+    for (long i = 0; i < n; i++) {
+#ifdef _OPENMP
+      LocalBins *mine = &lb[omp_get_thread_num()];
+#else
+      LocalBins *mine = &lb[0];
+#endif
+      int u = frontier.v[i];
+      int du = dist[u];
+      for (long k = g->off[u]; k < g->off[u + 1]; k++) {
+        if (g->cost[k] <= delta)
+          continue;
+        int nd = du + g->cost[k];
+        if (atomic_min(&dist[g->adj[k]], nd) &&
+            !bins_push(mine, nd / delta, g->adj[k]))
+          mine->failed = 1;
+      }
+    }
+
+    for (int t = 0; t < threads; t++)
+      failed |= lb[t].failed;
+    if (failed || n < 0) {
+      failed = 1;
+      break;
+    }
+  }
+
+  for (int t = 0; t < threads; t++) {
+    for (long b = 0; b < lb[t].nb; b++)
+      free(lb[t].bins[b].v);
+    free(lb[t].bins);
+    free(lb[t].settled.v);
+  }
+  free(lb);
+  free(offset);
+  free(mark);
+  free(frontier.v);
+
+  if (failed) {
+    fprintf(stderr, "Memory allocation failed for delta-stepping buckets.\n");
+    return -1;
+  }
+
+#pragma omp parallel for
+  for (int v = 0; v < g->nn; v++)
+    if (dist[v] == INT_MAX)
+      dist[v] = INF;
+
+  return 0;
+}
@@ -0,0 +1,195 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../common/include/graphgen.h"
+#include "include/graph.h"
+#include "include/maxflow.h"
+
+/*
+ * Benchmarks Dinic against highest-label push-relabel on synthetic undirected
+ * networks (grid, Erdos-Renyi, R-MAT), edge costs in [1, MAX_COST] used as
+ * capacities. A super source feeds the sqrt(V) vertices closest (in hops) to
+ * the first edge's endpoint, a super sink drains the sqrt(V) vertices closest
+ * to the vertex farthest from it. Each result must be a valid flow whose
+ * value equals the capacity of its minimum cut, both algorithms must agree,
+ * and so must Dinic on the network built from the adjacency lists.
+ *
+ * Usage: flowbench [V=1048576]
+ */
+
+#define AVG_DEGREE 4
+#define MAX_COST 1000
+#define TERMINAL_COST 1000000
+#define SEED 5
+
+static double nowMs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+/*
+ * BFS from `s` over the original arcs; `order` receives the reached vertices
+ * by increasing hops. Returns their number.
+ */
+static int bfs_order(const FlowNetwork *f, int s, int *order) {
+  char *seen = (char *)calloc(f->nn, 1);
+  if (!seen)
+    return 0;
+
+  int head = 0, tail = 0;
+  seen[s] = 1;
+  order[tail++] = s;
+  while (head < tail) {
+    int u = order[head++];
+    for (long k = f->off[u]; k < f->off[u + 1]; k++) {
+      if (f->orig[k] > 0 && !seen[f->to[k]]) {
+        seen[f->to[k]] = 1;
+        order[tail++] = f->to[k];
+      }
+    }
+  }
+
+  free(seen);
+  return tail;
+}
+
+/*
+ * Copies `el` and adds a super source `nn` and a super sink `nn + 1`, joined
+ * by TERMINAL_COST edges to the first `k` vertices of `nearA` and `nearB`.
+ */
+static EdgeList *with_terminals(const EdgeList *el, const int *nearA,
+                                const int *nearB, int k) {
+  EdgeList *out = createEdgeList(el->nn + 2, el->ne + 2L * k, 0, 1);
+  if (!out)
+    return NULL;
+
+  memcpy(out->src, el->src, el->ne * sizeof(int));
+  memcpy(out->dst, el->dst, el->ne * sizeof(int));
+  memcpy(out->cost, el->cost, el->ne * sizeof(int));
+  for (int i = 0; i < k; i++) {
+    long e = el->ne + 2L * i;
+    out->src[e] = el->nn;
+    out->dst[e] = nearA[i];
+    out->src[e + 1] = nearB[i];
+    out->dst[e + 1] = el->nn + 1;
+    out->cost[e] = out->cost[e + 1] = TERMINAL_COST;
+  }
+  return out;
+}
+
+/*
+ * Checks capacities and conservation (net outflow `flow` at s, 0 elsewhere
+ * except t), then that the minimum cut has capacity `flow`.
+ */
+static int check_flow(const FlowNetwork *f, int s, int t, long long flow,
+                      long *cut_edges) {
+  char *side = (char *)malloc(f->nn);
+  long *cut = (long *)malloc((f->na > 0 ? f->na : 1) * sizeof(long));
+  if (!side || !cut) {
+    free(side);
+    free(cut);
+    return 0;
+  }
+
+  int ok = 1;
+  for (int v = 0; v < f->nn && ok; v++) {
+    long long out = 0;
+    for (long k = f->off[v]; k < f->off[v + 1]; k++) {
+      ok &= f->cap[k] >= 0;
+      out += f->orig[k] - f->cap[k];
+    }
+    ok &= out == (v == s ? flow : v == t ? -flow : 0);
+  }
+
+  long count = min_cut(f, t, side, cut);
+  long long capacity = 0;
+  for (long i = 0; i < count; i++)
+    capacity += f->orig[cut[i]];
+  ok &= count >= 0 && side[s] && !side[t] && capacity == flow;
+  *cut_edges = count;
+
+  free(side);
+  free(cut);
+  return ok;
+}
+
+static int run_case(GraphGenKind kind, int nn) {
+  EdgeList *base = generateGraph(kind, nn, (long)nn * AVG_DEGREE, 0,
+                                 MAX_COST, SEED);
+  FlowNetwork *bf = base ? flow_network_from_edges(base) : NULL;
+  int *nearA = base ? (int *)malloc(base->nn * sizeof(int)) : NULL;
+  int *nearB = base ? (int *)malloc(base->nn * sizeof(int)) : NULL;
+  if (!bf || !nearA || !nearB)
+    return 0;
+
+  // Terminals around the first edge's endpoint and the vertex farthest away
+  int reached = bfs_order(bf, base->src[0], nearA);
+  int k = 1;
+  while ((long)k * k < base->nn)
+    k++;
+  if (k > reached / 2)
+    k = reached / 2 > 0 ? reached / 2 : 1;
+  bfs_order(bf, nearA[reached - 1], nearB);
+
+  EdgeList *el = with_terminals(base, nearA, nearB, k);
+  FlowNetwork *f = el ? flow_network_from_edges(el) : NULL;
+  if (!f)
+    return 0;
+  int s = base->nn, t = base->nn + 1;
+
+  long cut = 0;
+  double t0 = nowMs();
+  long long dinic = max_flow_dinic(f, s, t);
+  double dinicMs = nowMs() - t0;
+  int ok = check_flow(f, s, t, dinic, &cut);
+
+  flow_network_reset(f);
+  t0 = nowMs();
+  long long pr = max_flow_push_relabel(f, s, t);
+  double prMs = nowMs() - t0;
+  ok &= check_flow(f, s, t, pr, &cut) && pr == dinic;
+
+  // Same graph through the adjacency lists (one arc per list entry)
+  TGraphL G;
+  alloc_list_from_edges(&G, el);
+  FlowNetwork *fl = flow_network_from_graph(&G);
+  ok &= fl && max_flow_dinic(fl, s, t) == dinic;
+
+  printf("%-5s %9d %9ld %9d %12lld %9ld %12.1f %12.1f   %s\n",
+         graphGenName(kind), base->nn, base->ne, k, dinic, cut, dinicMs, prMs,
+         ok ? "same" : "DIFFERENT");
+
+  flow_network_free(fl);
+  destroyGraphAdjList(&G);
+  flow_network_free(f);
+  freeEdgeList(el);
+  flow_network_free(bf);
+  freeEdgeList(base);
+  free(nearA);
+  free(nearB);
+  return ok;
+}
+
+int main(int argc, char *argv[]) {
+  int nn = argc > 1 ? atoi(argv[1]) : 1048576;
+  if (nn < 4) {
+    fprintf(stderr, "Usage: %s [V >= 4]\n", argv[0]);
+    return 1;
+  }
+
+  printf("%-5s %9s %9s %9s %12s %9s %12s %12s   %s\n", "graph", "V", "E",
+         "terminals", "max flow", "cut", "dinic ms", "push-rel ms", "results");
+
+  int ok = run_case(GRAPHGEN_GRID, nn);
+  ok &= run_case(GRAPHGEN_ERDOS_RENYI, nn);
+  ok &= run_case(GRAPHGEN_RMAT, nn);
+
+  printf(ok ? "Dinic and push-relabel match\n"
+            : "Dinic and push-relabel DIFFER\n");
+  return ok ? 0 : 1;
+}
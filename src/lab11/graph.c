@@ -1,23 +1,12 @@
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "include/bucketqueue.h"
+#include "include/graph.h"
 #include "include/minheap.h"
-
-#define INF 999999
-
-typedef int TCost;
-
-typedef struct node {
-  int v;
-  TCost c;
-  struct node *next;
-} TNode, *ATNode;
-
-typedef struct {
-  int nn;
-  ATNode *adl;
-} TGraphL;
+#include "include/radixheap.h"
 
 /**
  * Allocate memory for an adjacency list representation of a graph.
@@ -35,96 +24,383 @@ void alloc_list(TGraphL *G, int n) {
     G->adl[i] = NULL;
 }
 
+/**
+ * Allocates the graph from a shared edge list.
+ */
+void alloc_list_from_edges(TGraphL *G, const EdgeList *el) {
+  alloc_list(G, el->nn);
+
+  for (long e = 0; e < el->ne; e++) {
+    int c = el->weighted ? el->cost[e] : 0;
+    if (el->directed)
+      insert_arc_list(G, el->src[e], el->dst[e], c);
+    else
+      insert_edge_list(G, el->src[e], el->dst[e], c);
+  }
+}
+
+/**
+ * Inserts the arc u -> v at the front of u's list; invalid endpoints and
+ * allocation failures are reported and leave the graph unchanged.
+ */
+void insert_arc_list(TGraphL *G, int u, int v, int c) {
+  if (u < 0 || v < 0 || u >= G->nn || v >= G->nn) {
+    fprintf(stderr, "Invalid edge (%d, %d).\n", u, v);
+    return;
+  }
+
+  TNode *t = (TNode *)malloc(sizeof(TNode));
+  if (!t) {
+    fprintf(stderr, "Memory allocation failed for edge.\n");
+    return;
+  }
+  t->v = v;
+  t->c = c;
+  t->next = G->adl[u];
+  G->adl[u] = t;
+}
+
 /**
  * Inserts an undirected edge into the graph.
  */
 void insert_edge_list(TGraphL *G, int v1, int v2, int c) {
-  TNode *t;
+  if (v1 < 0 || v2 < 0 || v1 >= G->nn || v2 >= G->nn) {
+    fprintf(stderr, "Invalid edge (%d, %d).\n", v1, v2);
+    return;
+  }
 
-  t = (TNode *)malloc(sizeof(TNode));
-  t->v = v2;
-  t->c = c;
-  t->next = G->adl[v1];
-  G->adl[v1] = t;
+  insert_arc_list(G, v1, v2, c);
+  insert_arc_list(G, v2, v1, c);
+}
 
-  t = (TNode *)malloc(sizeof(TNode));
-  t->v = v1;
-  t->c = c;
-  t->next = G->adl[v2];
-  G->adl[v2] = t;
+/**
+ * Returns the largest edge cost, which bounds the key spread of Dial's queue.
+ */
+TCost max_edge_cost(TGraphL *G) {
+  TCost maxCost = 0;
+  for (int u = 0; u < G->nn; u++)
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next)
+      if (nod->c > maxCost)
+        maxCost = nod->c;
+  return maxCost;
 }
 
 /**
- * Implements Dijkstra’s algorithm using a MinHeap-based priority queue.
+ * Addressable monotone priority queue used by Dijkstra, dispatching to one of
+ * the queue implementations selected by `QueueType`.
  */
-void dijkstra(TGraphL G, int s) {
-  int *dist = (int *)malloc(G.nn * sizeof(int));
-  APriQueue shortpath = makeQueue(G.nn);
+typedef struct {
+  int size;
+  AIndexedPriQueue heap;
+  ABucketQueue dial;
+  ARadixHeap radix;
+} SPQueue;
+
+static int spq_init(SPQueue *q, TGraphL *G, QueueType type) {
+  q->size = 0;
+  q->heap = NULL;
+  q->dial = NULL;
+  q->radix = NULL;
+
+  switch (type) {
+  case QUEUE_DIAL:
+    q->dial = makeBucketQueue(G->nn, max_edge_cost(G));
+    return q->dial != NULL;
+  case QUEUE_RADIX_HEAP:
+    q->radix = makeRadixHeap(G->nn);
+    return q->radix != NULL;
+  default:
+    q->heap = makeIndexedQueue(G->nn);
+    return q->heap != NULL;
+  }
+}
+
+/* Inserts `v`, or lowers its key if it is already queued. */
+static void spq_push(SPQueue *q, int v, int key, int queued) {
+  if (!queued)
+    q->size++;
+
+  if (q->heap) {
+    if (queued)
+      decreaseKey(q->heap, v, key);
+    else
+      insertIndexed(q->heap, v, key);
+  } else if (q->dial) {
+    if (queued)
+      decreaseKeyBucket(q->dial, v, key);
+    else
+      insertBucket(q->dial, v, key);
+  } else {
+    if (queued)
+      decreaseKeyRadix(q->radix, v, key);
+    else
+      insertRadix(q->radix, v, key);
+  }
+}
 
-  for (int i = 0; i < G.nn; i++)
-    dist[i] = INF;
+static int spq_pop(SPQueue *q) {
+  q->size--;
+  if (q->heap)
+    return removeMinIndexed(q->heap).content;
+  if (q->dial)
+    return removeMinBucket(q->dial, NULL);
+  return removeMinRadix(q->radix, NULL);
+}
+
+static void spq_free(SPQueue *q) {
+  freeIndexedQueue(q->heap);
+  freeBucketQueue(q->dial);
+  freeRadixHeap(q->radix);
+}
+
+/**
+ * Implements Dijkstra’s algorithm over an addressable priority queue: every
+ * vertex is queued at most once and improvements use a decrease-key. Dial's
+ * queue and the radix heap rely on keys being monotone, which holds because
+ * costs are non-negative.
+ */
+int dijkstra_queue(TGraphL *G, int s, QueueType type, int *dist) {
+  SPQueue q;
+  if (!spq_init(&q, G, type)) {
+    fprintf(stderr, "Memory allocation failed for the priority queue.\n");
+    for (int i = 0; i < G->nn; i++)
+      dist[i] = INF;
+    return -1;
+  }
+
+  // INT_MAX marks unreached vertices while running: real distances may
+  // exceed INF on large graphs. INF is reported after.
+  for (int i = 0; i < G->nn; i++)
+    dist[i] = INT_MAX;
 
   dist[s] = 0;
-  insert(shortpath, (ItemType){s, dist[s]});
+  spq_push(&q, s, 0, 0);
 
-  while (shortpath->size > 0) {
-    ItemType min = removeMin(shortpath);
-    int u = min.content;
+  while (q.size > 0) {
+    int u = spq_pop(&q);
 
-    for (TNode *nod = G.adl[u]; nod; nod = nod->next) {
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next) {
       int v = nod->v;
       if (dist[u] + nod->c < dist[v]) {
+        // Unreached vertices were never queued; settled ones cannot improve
+        int queued = dist[v] != INT_MAX;
         dist[v] = dist[u] + nod->c;
-        insert(shortpath, (ItemType){v, dist[v]});
+        spq_push(&q, v, dist[v], queued);
+      }
+    }
+  }
+
+  for (int i = 0; i < G->nn; i++)
+    if (dist[i] == INT_MAX)
+      dist[i] = INF;
+
+  spq_free(&q);
+  return 0;
+}
+
+/**
+ * Allocates a query workspace; `seen` starts at 0 and `stamp` at 1, so no
+ * vertex is considered reached before the first query.
+ */
+SPWorkspace *sp_workspace_create(int nn) {
+  SPWorkspace *ws = (SPWorkspace *)calloc(1, sizeof(SPWorkspace));
+  if (!ws) {
+    fprintf(stderr, "Memory allocation failed for query workspace.\n");
+    return NULL;
+  }
+
+  ws->nn = nn;
+  ws->stamp = 1;
+  ws->source = -1;
+  ws->seen = (unsigned *)calloc(nn, sizeof(unsigned));
+  ws->dist = (int *)malloc(nn * sizeof(int));
+  ws->pred = (int *)malloc(nn * sizeof(int));
+  ws->heap = makeIndexedQueue(nn);
+  if (!ws->seen || !ws->dist || !ws->pred || !ws->heap) {
+    fprintf(stderr, "Memory allocation failed for query workspace.\n");
+    sp_workspace_free(ws);
+    return NULL;
+  }
+
+  return ws;
+}
+
+void sp_workspace_free(SPWorkspace *ws) {
+  if (!ws)
+    return;
+  free(ws->seen);
+  free(ws->dist);
+  free(ws->pred);
+  freeIndexedQueue(ws->heap);
+  free(ws);
+}
+
+/* Starts a new query: bumping the stamp invalidates every previous entry. */
+void sp_begin(SPWorkspace *ws) {
+  ws->stamp++;
+  if (ws->stamp == 0) {
+    memset(ws->seen, 0, ws->nn * sizeof(unsigned));
+    ws->stamp = 1;
+  }
+}
+
+int sp_query(const TGraphL *G, int s, int t, SPWorkspace *ws) {
+  if (!G || !ws || G->nn > ws->nn || s < 0 || s >= G->nn || t >= G->nn)
+    return INF;
+
+  sp_begin(ws);
+  ws->source = s;
+  ws->settled = 0;
+
+  ws->seen[s] = ws->stamp;
+  ws->dist[s] = 0;
+  ws->pred[s] = -1;
+  insertIndexed(ws->heap, s, 0);
+
+  while (ws->heap->size > 0) {
+    int u = removeMinIndexed(ws->heap).content;
+    ws->settled++;
+    if (u == t)
+      break;
+
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next) {
+      int v = nod->v;
+      int nd = ws->dist[u] + nod->c;
+
+      if (ws->seen[v] != ws->stamp) {
+        ws->seen[v] = ws->stamp;
+        ws->dist[v] = nd;
+        ws->pred[v] = u;
+        insertIndexed(ws->heap, v, nd);
+      } else if (nd < ws->dist[v]) {
+        ws->dist[v] = nd;
+        ws->pred[v] = u;
+        decreaseKey(ws->heap, v, nd);
       }
     }
   }
 
+  // Early exit leaves vertices queued; reset only those
+  clearIndexedQueue(ws->heap);
+
+  return t >= 0 ? sp_dist(ws, t) : 0;
+}
+
+int sp_dist(const SPWorkspace *ws, int v) {
+  return ws->seen[v] == ws->stamp ? ws->dist[v] : INF;
+}
+
+int sp_pred(const SPWorkspace *ws, int v) {
+  return ws->seen[v] == ws->stamp ? ws->pred[v] : -1;
+}
+
+int sp_path(const SPWorkspace *ws, int t, int *path) {
+  if (ws->seen[t] != ws->stamp)
+    return 0;
+
+  int len = 0;
+  for (int v = t; v >= 0; v = ws->pred[v])
+    path[len++] = v;
+
+  for (int i = 0, j = len - 1; i < j; i++, j--) {
+    int aux = path[i];
+    path[i] = path[j];
+    path[j] = aux;
+  }
+  return len;
+}
+
+void sp_export(const SPWorkspace *ws, int *dist, int *pred) {
+  for (int v = 0; v < ws->nn; v++) {
+    if (dist)
+      dist[v] = sp_dist(ws, v);
+    if (pred)
+      pred[v] = sp_pred(ws, v);
+  }
+}
+
+/**
+ * Prints the distances computed by Dijkstra’s algorithm from `s`.
+ */
+void dijkstra(TGraphL G, int s) {
+  int *dist = (int *)malloc(G.nn * sizeof(int));
+  if (!dist) {
+    fprintf(stderr, "Memory allocation failed for distances.\n");
+    return;
+  }
+
+  if (dijkstra_queue(&G, s, QUEUE_BINARY_HEAP, dist) != 0) {
+    free(dist);
+    return;
+  }
+
   printf("\nVertex  Distance from Source\n");
   for (int n = 0; n < G.nn; n++)
     printf("%d\t\t%d\n", n, dist[n]);
 
   free(dist);
-  freeQueue(shortpath);
 }
 
 /**
- * Implements Prim’s algorithm using a MinHeap-based priority queue.
+ * Implements Prim’s algorithm using an Indexed MinHeap. A vertex leaves the
+ * queue exactly once, when it joins the tree; only vertices still queued
+ * can have their key and parent updated.
  */
-void Prim(TGraphL G) {
-  int *P = (int *)malloc(G.nn * sizeof(int));
-  int *K = (int *)malloc(G.nn * sizeof(int));
-  APriQueue shortpath = makeQueue(G.nn);
+long long prim_mst(TGraphL *G, int *P, int *K) {
+  AIndexedPriQueue shortpath = makeIndexedQueue(G->nn);
+  if (!shortpath)
+    return -1;
 
-  for (int v = 1; v < G.nn; ++v) {
+  for (int v = 0; v < G->nn; ++v) {
     P[v] = -1;
-    K[v] = INF;
-    insert(shortpath, (ItemType){v, K[v]});
+    K[v] = v == 0 ? 0 : INF;
+    insertIndexed(shortpath, v, K[v]);
   }
 
-  K[0] = 0;
-  insert(shortpath, (ItemType){0, K[0]});
-
   while (shortpath->size > 0) {
-    ItemType node = removeMin(shortpath);
+    ItemType node = removeMinIndexed(shortpath);
     int u = node.content;
 
-    for (TNode *nod = G.adl[u]; nod; nod = nod->next) {
-      if (nod->c < K[nod->v]) {
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next) {
+      if (containsIndexed(shortpath, nod->v) && nod->c < K[nod->v]) {
         K[nod->v] = nod->c;
         P[nod->v] = u;
-        insert(shortpath, (ItemType){nod->v, K[nod->v]});
+        decreaseKey(shortpath, nod->v, K[nod->v]);
       }
     }
   }
 
+  long long total = 0;
+  for (int v = 0; v < G->nn; v++)
+    if (P[v] >= 0)
+      total += K[v];
+
+  freeIndexedQueue(shortpath);
+  return total;
+}
+
+/**
+ * Prints the minimum spanning tree computed by `prim_mst`.
+ */
+void Prim(TGraphL G) {
+  int *P = (int *)malloc(G.nn * sizeof(int));
+  int *K = (int *)malloc(G.nn * sizeof(int));
+  if (!P || !K) {
+    fprintf(stderr, "Memory allocation failed for Prim.\n");
+    free(P);
+    free(K);
+    return;
+  }
+
+  long long total = prim_mst(&G, P, K);
+
   printf("\nEdge  Weight\n");
   for (int n = 1; n < G.nn; n++)
     printf("%d - %d\t%d\n", P[n], n, K[n]);
+  printf("Total\t%lld\n", total);
 
   free(P);
   free(K);
-  freeQueue(shortpath);
 }
 
 /**
@@ -175,32 +451,3 @@ void destroyGraphAdjList(TGraphL *G) {
   }
   free(G->adl);
 }
-
-int main() {
-  int i, v1, v2, c;
-  int V, E;
-  TGraphL G;
-
-  freopen("../data/graph.in", "r", stdin);
-  scanf("%d %d", &V, &E);
-  alloc_list(&G, V);
-
-  for (i = 0; i < E; i++) {
-    scanf("%d %d %d", &v1, &v2, &c);
-    insert_edge_list(&G, v1, v2, c);
-  }
-
-  printf("\nAdjacency List:\n");
-  for (i = 0; i < G.nn; i++) {
-    printf("%d : ", i);
-    for (TNode *t = G.adl[i]; t != NULL; t = t->next)
-      printf("%d(%d) ", t->v, t->c);
-    printf("\n");
-  }
-
-  dijkstra(G, 0);
-  Prim(G);
-  destroyGraphAdjList(&G);
-
-  return 0;
-}
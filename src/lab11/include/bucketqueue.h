@@ -0,0 +1,48 @@
+#ifndef __BUCKETQUEUE_H__
+#define __BUCKETQUEUE_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * Structure representing Dial's bucket queue for monotone integer keys.
+ * Keys in the queue always lie in `[cur, cur + maxCost]`, so `maxCost + 1`
+ * circular buckets suffice. Buckets are intrusive doubly linked lists over
+ * item ids, which makes insert, decrease-key and remove O(1).
+ * - `nb`: number of buckets (`maxCost + 1`).
+ * - `head`: first id of every bucket, or -1.
+ * - `next`, `prev`: list links of every id.
+ * - `key`: current key of every id, or -1 if the id is not queued.
+ * - `cur`: lower bound of all queued keys.
+ */
+typedef struct {
+  int capacity;
+  int size;
+  int nb;
+  int cur;
+  int *head;
+  int *next;
+  int *prev;
+  int *key;
+} BucketQueue, *ABucketQueue;
+
+/* ========================== FUNCTION DECLARATIONS ========================= */
+
+/* Creates an empty bucket queue for ids `0 .. capacity-1`. */
+ABucketQueue makeBucketQueue(int capacity, int maxCost);
+
+/* Inserts `id` with key `key >= cur`. */
+void insertBucket(ABucketQueue q, int id, int key);
+
+/* Lowers the key of a queued `id` to `key`. */
+void decreaseKeyBucket(ABucketQueue q, int id, int key);
+
+/* Removes and returns the id with minimum key; `*key` receives its key. */
+int removeMinBucket(ABucketQueue q, int *key);
+
+/* Frees all memory allocated for the bucket queue. */
+void freeBucketQueue(ABucketQueue q);
+
+/* ========================================================================== */
+
+#endif // __BUCKETQUEUE_H__
@@ -0,0 +1,61 @@
+#ifndef __CONTRACTION_H__
+#define __CONTRACTION_H__
+
+#include "graph.h"
+
+/* Settled-vertex budget of a single witness search. */
+#define CH_WITNESS_LIMIT 500
+
+/**
+ * Structure representing a Contraction Hierarchy of an undirected graph.
+ * Vertices are contracted in `rank` order; contracting a vertex adds
+ * shortcuts between its remaining neighbours unless a witness path is at
+ * least as short. Only upward arcs (towards higher rank) are kept, stored in
+ * CSR form: the arcs of `u` are `head/cost[off[u] .. off[u + 1])`.
+ */
+typedef struct {
+  int nn;
+  long na;
+  int *rank;
+  long *off;
+  int *head;
+  int *cost;
+} CHGraph;
+
+/* ========================== FUNCTION DECLARATIONS ========================= */
+
+/**
+ * Builds the hierarchy: vertices are ordered lazily by edge difference plus
+ * the number of already contracted neighbours, and witness searches are
+ * local Dijkstras bounded by distance and by `CH_WITNESS_LIMIT` settled
+ * vertices. `*shortcuts` (optional) receives the number of shortcuts added.
+ */
+CHGraph *ch_build(const TGraphL *G, long *shortcuts);
+
+/**
+ * Shortest distance between `s` and `t` (INF if unreachable): two upward
+ * Dijkstra searches in `fwd` and `bwd` (workspaces of at least `nn`
+ * vertices), each pruned once its smallest key reaches the best meeting.
+ */
+int ch_query(const CHGraph *ch, int s, int t, SPWorkspace *fwd,
+             SPWorkspace *bwd);
+
+/**
+ * Writes the hierarchy to `path`: a 24-byte header ("SDACHIER", version,
+ * `nn`, `na`) followed by `rank`, `off` (as int64), `head` and `cost`.
+ * Returns 0 on success, -1 on error.
+ */
+int ch_save(const CHGraph *ch, const char *path);
+
+/*
+ * Reads a hierarchy written by `ch_save`; NULL if the file is invalid
+ * (offsets not rising from 0 to `na`, or an arc head out of range).
+ */
+CHGraph *ch_load(const char *path);
+
+/* Frees a hierarchy. */
+void ch_free(CHGraph *ch);
+
+/* ========================================================================== */
+
+#endif // __CONTRACTION_H__
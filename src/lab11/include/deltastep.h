@@ -0,0 +1,30 @@
+#ifndef __DELTASTEP_H__
+#define __DELTASTEP_H__
+
+#include "../../common/include/csr.h"
+#include "graph.h"
+
+/* ========================== FUNCTION DECLARATIONS ========================= */
+
+/**
+ * Converts the adjacency lists into a weighted CSR graph. Arcs keep the
+ * order of each list, so both directions of every undirected edge appear.
+ */
+CsrGraph *graph_to_csr(const TGraphL *G);
+
+/**
+ * Parallel delta-stepping single-source shortest paths. Tentative distances
+ * are grouped into buckets of width `delta` and arcs are split into light
+ * (cost <= delta) and heavy ones. The current bucket is emptied in parallel
+ * relaxing light arcs only, with an atomic-min on `dist` and thread-local
+ * buckets, until it stays empty; then the heavy arcs of all its vertices are
+ * relaxed once. No locks are taken and the result is exact: `dist` equals
+ * the output of `dijkstra_queue` (INF if unreachable). Small `delta`
+ * approaches Dijkstra, large `delta` approaches Bellman-Ford. Costs must be
+ * non-negative. Returns 0, or -1 on error.
+ */
+int delta_stepping(const CsrGraph *g, int s, int delta, int *dist);
+
+/* ========================================================================== */
+
+#endif // __DELTASTEP_H__
@@ -0,0 +1,147 @@
+#ifndef __GRAPH_H__
+#define __GRAPH_H__
+
+#include "../../common/include/graphio.h"
+
+#define INF 999999
+
+typedef int TCost;
+
+/**
+ * Structure representing an adjacency list node.
+ * - `v`: destination vertex.
+ * - `c`: cost of the edge.
+ */
+typedef struct node {
+  int v;
+  TCost c;
+  struct node *next;
+} TNode, *ATNode;
+
+/**
+ * Structure representing a weighted undirected graph.
+ * - `nn`: number of vertices.
+ * - `adl`: array of adjacency lists.
+ */
+typedef struct {
+  int nn;
+  ATNode *adl;
+} TGraphL;
+
+/**
+ * Priority queue used by `dijkstra_queue`. All of them are addressable
+ * (decrease-key in place), so each holds at most `nn` vertices.
+ * - `QUEUE_BINARY_HEAP`: indexed binary heap, any non-negative costs.
+ * - `QUEUE_DIAL`: Dial's circular bucket queue, O(1) per operation, memory
+ *   proportional to the largest edge cost.
+ * - `QUEUE_RADIX_HEAP`: monotone radix heap, O(log C) amortized per vertex.
+ */
+typedef enum { QUEUE_BINARY_HEAP, QUEUE_DIAL, QUEUE_RADIX_HEAP } QueueType;
+
+/**
+ * Structure representing a reusable, caller-owned workspace for repeated
+ * shortest-path queries on graphs with up to `nn` vertices.
+ * - `stamp`: id of the current query; `dist[v]` and `pred[v]` are only
+ *   meaningful when `seen[v] == stamp`, so nothing is cleared between
+ *   queries.
+ * - `dist`, `pred`: distance and predecessor of every reached vertex.
+ * - `heap`: indexed priority queue, left empty after every query.
+ * - `source`, `settled`: source and number of settled vertices of the last
+ *   query.
+ */
+typedef struct {
+  int nn;
+  unsigned stamp;
+  unsigned *seen;
+  int *dist;
+  int *pred;
+  struct IndexedPriQueue *heap;
+  int source;
+  int settled;
+} SPWorkspace;
+
+/* ========================== FUNCTION DECLARATIONS ========================= */
+
+/* Allocates the adjacency lists of a graph with `n` vertices. */
+void alloc_list(TGraphL *G, int n);
+
+/* Inserts an undirected edge (v1, v2) with cost `c`. */
+void insert_edge_list(TGraphL *G, int v1, int v2, int c);
+
+/* Inserts a single arc u -> v with cost `c`; invalid endpoints are skipped. */
+void insert_arc_list(TGraphL *G, int u, int v, int c);
+
+/*
+ * Allocates `G` from a shared edge list (see graphio.h): `insert_arc_list`
+ * per edge for directed lists, `insert_edge_list` otherwise; cost 0 for
+ * unweighted lists. Edges with an endpoint outside `[0, nn)` are skipped.
+ */
+void alloc_list_from_edges(TGraphL *G, const EdgeList *el);
+
+/* Returns the largest edge cost in the graph (0 for an edgeless graph). */
+TCost max_edge_cost(TGraphL *G);
+
+/**
+ * Computes shortest distances from `s` into `dist` (INF if unreachable)
+ * using the selected priority queue. Costs must be non-negative. Returns 0,
+ * or -1 if the queue cannot be allocated (`dist` is then all INF).
+ */
+int dijkstra_queue(TGraphL *G, int s, QueueType type, int *dist);
+
+/* Creates a query workspace for graphs with up to `nn` vertices. */
+SPWorkspace *sp_workspace_create(int nn);
+
+/* Frees a query workspace. */
+void sp_workspace_free(SPWorkspace *ws);
+
+/* Starts a new query on `ws`, invalidating the previous results in O(1). */
+void sp_begin(SPWorkspace *ws);
+
+/**
+ * Runs Dijkstra from `s` using the buffers of `ws`. If `t >= 0` the search
+ * stops as soon as `t` is settled; only the distances of settled vertices are
+ * then final. Returns the distance to `t` (INF if unreachable), or 0 when
+ * `t < 0`.
+ */
+int sp_query(const TGraphL *G, int s, int t, SPWorkspace *ws);
+
+/* Distance of `v` found by the last query, INF if it was not reached. */
+int sp_dist(const SPWorkspace *ws, int v);
+
+/* Predecessor of `v` on the last query's tree, -1 for the source/unreached. */
+int sp_pred(const SPWorkspace *ws, int v);
+
+/**
+ * Writes the path `source .. t` of the last query into `path` (room for `nn`
+ * vertices). Returns the number of vertices, or 0 if `t` was not reached.
+ */
+int sp_path(const SPWorkspace *ws, int t, int *path);
+
+/* Copies the last query's results into full `dist` / `pred` arrays. */
+void sp_export(const SPWorkspace *ws, int *dist, int *pred);
+
+/* Prints the shortest distances from `s` (binary heap). */
+void dijkstra(TGraphL G, int s);
+
+/**
+ * Prim's MST from vertex 0: fills `P` (parent, -1 for the root and for
+ * vertices unreachable from 0) and `K` (cost of the edge to the parent).
+ * Returns the total weight of the tree, or -1 on allocation failure.
+ */
+long long prim_mst(TGraphL *G, int *P, int *K);
+
+/* Prints the minimum spanning tree rooted at vertex 0. */
+void Prim(TGraphL G);
+
+/* Removes an edge between v1 and v2. */
+void removeEdgeList(TGraphL *G, int v1, int v2);
+
+/* Removes all edges connected to a node v. */
+void removeNodeList(TGraphL *G, int v);
+
+/* Frees the entire adjacency list. */
+void destroyGraphAdjList(TGraphL *G);
+
+/* ========================================================================== */
+
+#endif // __GRAPH_H__
@@ -0,0 +1,25 @@
+#ifndef __KRUSKAL_H__
+#define __KRUSKAL_H__
+
+#include "../../common/include/graphio.h"
+
+/* ========================== FUNCTION DECLARATIONS ========================= */
+
+/**
+ * Fills `order` with the indices `0 .. el->ne-1` sorted by edge cost using a
+ * stable LSD radix sort (8-bit digits). Histograms and scatters of each pass
+ * run in parallel when compiled with OpenMP. Returns 0, or -1 on error.
+ */
+int sort_edges_by_cost(const EdgeList *el, long *order);
+
+/**
+ * Kruskal's minimum spanning forest over a flat, weighted edge list: edges
+ * are radix-sorted by cost and accepted through a union-find. `mst` (room
+ * for `nn - 1` entries) receives the indices of the accepted edges and
+ * `*count` their number. Returns the total weight, or -1 on error.
+ */
+long long kruskal_mst(const EdgeList *el, long *mst, long *count);
+
+/* ========================================================================== */
+
+#endif // __KRUSKAL_H__
@@ -0,0 +1,74 @@
+#ifndef __MAXFLOW_H__
+#define __MAXFLOW_H__
+
+#include "../../common/include/graphio.h"
+#include "graph.h"
+
+/**
+ * Residual network stored in arrays. The arcs leaving `u` are
+ * `off[u] .. off[u+1]-1`; arc `k` goes `from[k] -> to[k]`, `rev[k]` is its
+ * paired arc in the opposite direction, `cap[k]` its residual capacity and
+ * `orig[k]` the capacity it was built with (0 for pure reverse arcs). The
+ * flow on an arc is `orig[k] - cap[k]` (negative on the reverse side).
+ */
+typedef struct {
+  int nn;
+  long na;
+  long *off;
+  int *from;
+  int *to;
+  long *rev;
+  long long *cap;
+  int *orig;
+} FlowNetwork;
+
+/* ========================== FUNCTION DECLARATIONS ========================= */
+
+/**
+ * Builds a network from the adjacency lists: every list entry `u -> v` with
+ * cost `c` becomes an arc of capacity `c`, so an undirected edge carries up
+ * to `c` units in either direction. Returns NULL on error.
+ */
+FlowNetwork *flow_network_from_graph(const TGraphL *G);
+
+/**
+ * Builds a network from a shared edge list. An edge is one arc of capacity
+ * `cost` (1 for unweighted lists); undirected edges get the same capacity on
+ * the paired arc. Returns NULL on error.
+ */
+FlowNetwork *flow_network_from_edges(const EdgeList *el);
+
+/* Removes all flow: restores `cap` to `orig`. */
+void flow_network_reset(FlowNetwork *f);
+
+/* Frees a network. */
+void flow_network_free(FlowNetwork *f);
+
+/**
+ * Dinic's maximum flow from `s` to `t`: BFS level graphs, each saturated by
+ * an iterative blocking-flow DFS with current-arc pointers. Starts from the
+ * flow already in `f`. Returns the flow value, or -1 on error.
+ */
+long long max_flow_dinic(FlowNetwork *f, int s, int t);
+
+/**
+ * Highest-label push-relabel maximum flow from `s` to `t`, with the gap
+ * heuristic and periodic global relabeling (reverse BFS from the target).
+ * The first phase moves as much excess as possible to `t`; the second returns
+ * the rest to `s`, so `f` ends with a valid flow as with Dinic. Expects a
+ * network without flow. Returns the flow value, or -1 on error.
+ */
+long long max_flow_push_relabel(FlowNetwork *f, int s, int t);
+
+/**
+ * Minimum cut of a maximum flow: `side[v]` is set to 1 for the vertices
+ * that cannot reach `t` in the residual network (the source side), 0 for the
+ * others. `cut` (room for `f->na` arcs, may be NULL) receives the original
+ * arcs from the source side to the sink side; their capacities add up to
+ * the flow value. Returns the number of cut arcs, or -1 on error.
+ */
+long min_cut(const FlowNetwork *f, int t, char *side, long *cut);
+
+/* ========================================================================== */
+
+#endif // __MAXFLOW_H__
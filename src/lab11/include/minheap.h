@@ -30,6 +30,21 @@ typedef struct heap {
   ItemType *elem;
 } PriQueue, *APriQueue;
 
+/**
+ * Structure representing an Indexed MinHeap over item ids `0 .. capacity-1`.
+ * Each id appears at most once, so the size is bounded by `capacity`.
+ * - `heap`: heap-ordered array of ids.
+ * - `pos`: position of each id in `heap`, or -1 if the id is not queued.
+ * - `key`: current priority of each id.
+ */
+typedef struct IndexedPriQueue {
+  int capacity;
+  int size;
+  int *heap;
+  int *pos;
+  int *key;
+} IndexedPriQueue, *AIndexedPriQueue;
+
 /* ========================== FUNCTION DECLARATIONS ========================= */
 
 /* Creates a new priority queue with the given initial capacity. */
@@ -63,125 +78,33 @@ ItemType removeMin(APriQueue h);
 /* Frees all memory allocated for the priority queue. */
 void freeQueue(APriQueue h);
 
-/* ========================================================================== */
+/* Creates an empty indexed priority queue for ids `0 .. capacity-1`. */
+AIndexedPriQueue makeIndexedQueue(int capacity);
+
+/* Returns 1 if `id` is currently in the indexed queue, 0 otherwise. */
+int containsIndexed(AIndexedPriQueue h, int id);
+
+/* Inserts `id` with priority `key`; `id` must not already be queued. */
+void insertIndexed(AIndexedPriQueue h, int id, int key);
+
+/* Lowers the priority of a queued `id` to `key` (ignored if not lower). */
+void decreaseKey(AIndexedPriQueue h, int id, int key);
 
-APriQueue makeQueue(int capacity) {
-  if (capacity <= 0) {
-    fprintf(stderr, "Error: Capacity must be greater than zero.\n");
-    return NULL;
-  }
-
-  APriQueue h = (APriQueue)malloc(sizeof(PriQueue));
-  if (!h) {
-    fprintf(stderr, "Error: Memory allocation failed for priority queue.\n");
-    return NULL;
-  }
-
-  h->elem = (ItemType *)malloc(capacity * sizeof(ItemType));
-  if (!h->elem) {
-    fprintf(stderr, "Error: Memory allocation failed for heap elements.\n");
-    free(h);
-    return NULL;
-  }
-
-  h->capacity = capacity;
-  h->size = 0;
-  return h;
-}
-
-int getLeftChild(int i) { return 2 * i + 1; }
-int getRightChild(int i) { return 2 * i + 2; }
-int getParent(int i) { return (i - 1) / 2; }
-
-void siftUp(APriQueue h, int idx) {
-  int parent = getParent(idx);
-
-  while (parent >= 0 && h->elem[parent].prior > h->elem[idx].prior) {
-    ItemType aux = h->elem[parent];
-    h->elem[parent] = h->elem[idx];
-    h->elem[idx] = aux;
-
-    idx = parent;
-    parent = getParent(idx);
-  }
-}
-
-void insert(APriQueue h, ItemType x) {
-  if (!h) {
-    fprintf(stderr, "Error: Priority queue is NULL.\n");
-    return;
-  }
-
-  if (h->size == h->capacity) {
-    h->capacity *= 2;
-    ItemType *newElem =
-        (ItemType *)realloc(h->elem, h->capacity * sizeof(ItemType));
-    if (!newElem) {
-      fprintf(stderr,
-              "Error: Memory allocation failed during heap expansion.\n");
-      return;
-    }
-    h->elem = newElem;
-  }
-
-  h->elem[h->size] = x;
-  h->size++;
-  siftUp(h, h->size - 1);
-}
-
-ItemType getMin(APriQueue h) {
-  if (!h || h->size == 0) {
-    fprintf(stderr, "Error: Priority queue is empty.\n");
-    return (ItemType){0, 0};
-  }
-  return h->elem[0];
-}
-
-void siftDown(APriQueue h, int idx) {
-  int leftChild = getLeftChild(idx);
-  int rightChild = getRightChild(idx);
-  int smallest = idx;
-
-  if (leftChild < h->size &&
-      h->elem[leftChild].prior < h->elem[smallest].prior) {
-    smallest = leftChild;
-  }
-
-  if (rightChild < h->size &&
-      h->elem[rightChild].prior < h->elem[smallest].prior) {
-    smallest = rightChild;
-  }
-
-  if (smallest != idx) {
-    ItemType aux = h->elem[smallest];
-    h->elem[smallest] = h->elem[idx];
-    h->elem[idx] = aux;
-
-    siftDown(h, smallest);
-  }
-}
-
-ItemType removeMin(APriQueue h) {
-  if (!h || h->size == 0) {
-    fprintf(stderr, "Error: Cannot remove from empty priority queue.\n");
-    return (ItemType){0, 0};
-  }
-
-  ItemType min = getMin(h);
-  ItemType last = h->elem[h->size - 1];
-
-  h->size--;
-  h->elem[0] = last;
-  siftDown(h, 0);
-
-  return min;
-}
-
-void freeQueue(APriQueue h) {
-  if (!h)
-    return;
-  free(h->elem);
-  free(h);
-}
+/* Sets the priority of a queued `id` to `key`, moving it up or down. */
+void changeKey(AIndexedPriQueue h, int id, int key);
+
+/* Returns the id with minimum priority as {id, key} without removing it. */
+ItemType getMinIndexed(AIndexedPriQueue h);
+
+/* Removes and returns the id with minimum priority as {id, key}. */
+ItemType removeMinIndexed(AIndexedPriQueue h);
+
+/* Empties the indexed queue in O(size), keeping its memory. */
+void clearIndexedQueue(AIndexedPriQueue h);
+
+/* Frees all memory allocated for the indexed priority queue. */
+void freeIndexedQueue(AIndexedPriQueue h);
+
+/* ========================================================================== */
 
 #endif // __HEAP_H__
\ No newline at end of file
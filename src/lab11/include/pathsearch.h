@@ -0,0 +1,72 @@
+#ifndef __PATHSEARCH_H__
+#define __PATHSEARCH_H__
+
+#include "graph.h"
+
+/**
+ * Lower bound on the distance from `v` to `t`. A* is exact when the bound is
+ * admissible (never overestimates) and settles each vertex once when it is
+ * also consistent; `ctx` carries the heuristic's precomputed data.
+ */
+typedef int (*SPHeuristic)(int v, int t, void *ctx);
+
+/**
+ * Structure holding the precomputed data of the ALT heuristic
+ * (A*, Landmarks, Triangle inequality).
+ * - `nl`: number of landmarks.
+ * - `landmark`: the landmark vertices.
+ * - `dist`: distance from every landmark to every vertex, stored vertex-major
+ *   (`dist[v * nl + l]`) so a heuristic call reads two contiguous rows.
+ */
+typedef struct {
+  int nn;
+  int nl;
+  int *landmark;
+  int *dist;
+} ALTLandmarks;
+
+/* ========================== FUNCTION DECLARATIONS ========================= */
+
+/**
+ * Bidirectional Dijkstra between `s` and `t`: a forward search in `fwd` and a
+ * backward search in `bwd` (the graph is undirected) grow alternately, and
+ * stop once the sum of their smallest keys reaches the best meeting distance.
+ * Returns the distance (INF if unreachable); `*meet` receives the vertex
+ * where the best path joins, or -1.
+ */
+int bidijkstra_query(const TGraphL *G, int s, int t, SPWorkspace *fwd,
+                     SPWorkspace *bwd, int *meet);
+
+/**
+ * Writes the path `s .. t` found by `bidijkstra_query` into `path` (room for
+ * `nn` vertices). Returns the number of vertices, or 0 if there is no path.
+ */
+int bidijkstra_path(const SPWorkspace *fwd, const SPWorkspace *bwd, int meet,
+                    int *path);
+
+/**
+ * A* search from `s` to `t` ordering vertices by `dist + h(v, t)`. A NULL
+ * heuristic degenerates to Dijkstra with early exit. Results are read from
+ * `ws` like those of `sp_query`. Returns the distance (INF if unreachable).
+ */
+int astar_query(const TGraphL *G, int s, int t, SPHeuristic h, void *ctx,
+                SPWorkspace *ws);
+
+/**
+ * Picks `nl` landmarks by farthest-point selection and runs one Dijkstra per
+ * landmark to fill the distance table. Returns NULL on error.
+ */
+ALTLandmarks *alt_build(TGraphL *G, int nl);
+
+/*
+ * ALT bound: max over landmarks of |d(L, t) - d(L, v)|; `ctx` is
+ * ALTLandmarks.
+ */
+int alt_heuristic(int v, int t, void *ctx);
+
+/* Frees the landmark data. */
+void alt_free(ALTLandmarks *alt);
+
+/* ========================================================================== */
+
+#endif // __PATHSEARCH_H__
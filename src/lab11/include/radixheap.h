@@ -0,0 +1,50 @@
+#ifndef __RADIXHEAP_H__
+#define __RADIXHEAP_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define RADIX_BUCKETS 33
+
+/**
+ * Structure representing a monotone Radix Heap for non-negative int keys.
+ * Bucket `b` holds the ids whose key differs from `last` (the last removed
+ * minimum) first in bit `b - 1`; bucket 0 holds keys equal to `last`. Each
+ * id moves to lower buckets only, so the total work is O(log C) per id.
+ * Buckets are intrusive doubly linked lists, giving in-place decrease-key.
+ * - `head`: first id of every bucket, or -1.
+ * - `next`, `prev`: list links of every id.
+ * - `key`: current key of every id.
+ * - `bucket`: bucket of every id, or -1 if the id is not queued.
+ */
+typedef struct {
+  int capacity;
+  int size;
+  unsigned last;
+  int head[RADIX_BUCKETS];
+  int *next;
+  int *prev;
+  int *key;
+  int *bucket;
+} RadixHeap, *ARadixHeap;
+
+/* ========================== FUNCTION DECLARATIONS ========================= */
+
+/* Creates an empty radix heap for ids `0 .. capacity-1`. */
+ARadixHeap makeRadixHeap(int capacity);
+
+/* Inserts `id` with key `key >= last`. */
+void insertRadix(ARadixHeap h, int id, int key);
+
+/* Lowers the key of a queued `id` to `key >= last`. */
+void decreaseKeyRadix(ARadixHeap h, int id, int key);
+
+/* Removes and returns the id with minimum key; `*key` receives its key. */
+int removeMinRadix(ARadixHeap h, int *key);
+
+/* Frees all memory allocated for the radix heap. */
+void freeRadixHeap(ARadixHeap h);
+
+/* ========================================================================== */
+
+#endif // __RADIXHEAP_H__
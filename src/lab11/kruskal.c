@@ -0,0 +1,144 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../common/include/unionfind.h"
+#include "include/kruskal.h"
+
+#define RADIX_BITS 8
+#define RADIX_SIZE (1 << RADIX_BITS)
+
+static int max_threads(void) {
+#ifdef _OPENMP
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/**
+ * One stable counting-sort pass of `src` into `dst` on the digit at `shift`.
+ * Every thread counts its own contiguous chunk, the histograms are turned
+ * into per-(digit, thread) offsets, and each thread scatters its chunk.
+ */
+static void radix_pass(const uint64_t *src, uint64_t *dst, size_t n,
+                       int shift, size_t *hist, int threads) {
+#pragma omp parallel num_threads(threads)
+  {
+#ifdef _OPENMP
+    int t = omp_get_thread_num(), nt = omp_get_num_threads();
+#else
+    int t = 0, nt = 1;
+#endif
+    size_t lo = n * t / nt, hi = n * (t + 1) / nt;
+    size_t *mine = hist + (size_t)t * RADIX_SIZE;
+
+    for (int d = 0; d < RADIX_SIZE; d++)
+      mine[d] = 0;
+    for (size_t i = lo; i < hi; i++)
+      mine[(src[i] >> shift) & (RADIX_SIZE - 1)]++;
+
+#pragma omp barrier
+#pragma omp single
+    {
+      size_t sum = 0;
+      for (int d = 0; d < RADIX_SIZE; d++) {
+        for (int k = 0; k < nt; k++) {
+          size_t c = hist[(size_t)k * RADIX_SIZE + d];
+          hist[(size_t)k * RADIX_SIZE + d] = sum;
+          sum += c;
+        }
+      }
+    }
+
+    for (size_t i = lo; i < hi; i++)
+      dst[mine[(src[i] >> shift) & (RADIX_SIZE - 1)]++] = src[i];
+  }
+}
+
+int sort_edges_by_cost(const EdgeList *el, long *order) {
+  if (!el || !el->cost || !order || (uint64_t)el->ne > UINT32_MAX)
+    return -1;
+
+  size_t n = (size_t)el->ne;
+  if (n == 0)
+    return 0;
+
+  int threads = max_threads();
+  uint64_t *a = (uint64_t *)malloc(n * sizeof(uint64_t));
+  uint64_t *b = (uint64_t *)malloc(n * sizeof(uint64_t));
+  size_t *hist =
+      (size_t *)malloc((size_t)threads * RADIX_SIZE * sizeof(size_t));
+  if (!a || !b || !hist) {
+    fprintf(stderr, "Memory allocation failed for edge sort.\n");
+    free(a);
+    free(b);
+    free(hist);
+    return -1;
+  }
+
+  // Keys are costs shifted to start at 0, packed above the edge index
+  long minCost = el->cost[0], maxCost = el->cost[0];
+#pragma omp parallel for reduction(min : minCost) reduction(max : maxCost)
+  for (size_t i = 0; i < n; i++) {
+    if (el->cost[i] < minCost)
+      minCost = el->cost[i];
+    if (el->cost[i] > maxCost)
+      maxCost = el->cost[i];
+  }
+
+#pragma omp parallel for
+  for (size_t i = 0; i < n; i++)
+    a[i] = ((uint64_t)(el->cost[i] - minCost) << 32) | i;
+
+  // Only the digits the largest key actually uses need a pass
+  uint64_t range = (uint64_t)(maxCost - minCost);
+  for (int shift = 32; shift < 64 && (range >> (shift - 32)) > 0;
+       shift += RADIX_BITS) {
+    radix_pass(a, b, n, shift, hist, threads);
+    uint64_t *aux = a;
+    a = b;
+    b = aux;
+  }
+
+#pragma omp parallel for
+  for (size_t i = 0; i < n; i++)
+    order[i] = (long)(a[i] & UINT32_MAX);
+
+  free(a);
+  free(b);
+  free(hist);
+  return 0;
+}
+
+long long kruskal_mst(const EdgeList *el, long *mst, long *count) {
+  if (!el || !el->cost || !mst || !count)
+    return -1;
+
+  long *order = (long *)malloc((el->ne > 0 ? el->ne : 1) * sizeof(long));
+  UnionFind *uf = createUnionFind(el->nn);
+  if (!order || !uf || sort_edges_by_cost(el, order) != 0) {
+    free(order);
+    destroyUnionFind(uf);
+    return -1;
+  }
+
+  long long total = 0;
+  long k = 0;
+  for (long i = 0; i < el->ne && k < el->nn - 1; i++) {
+    long e = order[i];
+    if (unionSets(uf, el->src[e], el->dst[e])) {
+      mst[k++] = e;
+      total += el->cost[e];
+    }
+  }
+
+  *count = k;
+  free(order);
+  destroyUnionFind(uf);
+  return total;
+}
@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../common/include/graphio.h"
+#include "include/graph.h"
+#include "include/kruskal.h"
+#include "include/maxflow.h"
+
+int main() {
+  int i;
+  TGraphL G;
+
+  EdgeList *el = loadEdgeList("../data/graph.in", GRAPHIO_WEIGHTED);
+  if (!el)
+    return EXIT_FAILURE;
+
+  alloc_list_from_edges(&G, el);
+
+  printf("\nAdjacency List:\n");
+  for (i = 0; i < G.nn; i++) {
+    printf("%d : ", i);
+    for (TNode *t = G.adl[i]; t != NULL; t = t->next)
+      printf("%d(%d) ", t->v, t->c);
+    printf("\n");
+  }
+
+  dijkstra(G, 0);
+
+  SPWorkspace *ws = sp_workspace_create(G.nn);
+  if (ws) {
+    int *path = (int *)malloc(G.nn * sizeof(int));
+    printf("\nPath  Distance  Settled\n");
+    for (int t = 1; path && t < G.nn; t++) {
+      int d = sp_query(&G, 0, t, ws);
+      int len = sp_path(ws, t, path);
+      for (i = 0; i < len; i++)
+        printf("%d%s", path[i], i + 1 < len ? "-" : "");
+      printf("\t%d\t%d\n", d, ws->settled);
+    }
+    free(path);
+    sp_workspace_free(ws);
+  }
+
+  Prim(G);
+
+  long *mst = (long *)malloc(G.nn * sizeof(long)), count = 0;
+  long long total = mst ? kruskal_mst(el, mst, &count) : -1;
+  if (total >= 0) {
+    printf("\nKruskal Edge  Weight\n");
+    for (long k = 0; k < count; k++)
+      printf("%d - %d\t%d\n", el->src[mst[k]], el->dst[mst[k]],
+             el->cost[mst[k]]);
+    printf("Total\t%lld\n", total);
+  }
+  free(mst);
+
+  // Edge costs as capacities, flow from the first to the last vertex
+  FlowNetwork *f = flow_network_from_edges(el);
+  char *side = (char *)malloc(G.nn);
+  long *cut = NULL;
+  if (f)
+    cut = (long *)malloc((f->na > 0 ? f->na : 1) * sizeof(long));
+  if (f && side && cut && G.nn > 1) {
+    long long flow = max_flow_dinic(f, 0, G.nn - 1);
+    long count = min_cut(f, G.nn - 1, side, cut);
+    printf("\nMax flow 0 -> %d\t%lld\n", G.nn - 1, flow);
+    printf("Min cut Edge  Capacity\n");
+    for (long k = 0; k < count; k++)
+      printf("%d - %d\t%d\n", f->from[cut[k]], f->to[cut[k]],
+             f->orig[cut[k]]);
+  }
+  free(side);
+  free(cut);
+  flow_network_free(f);
+  freeEdgeList(el);
+
+  destroyGraphAdjList(&G);
+
+  return 0;
+}
@@ -0,0 +1,493 @@
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "include/maxflow.h"
+
+/*
+ * Push-relabel runs a global relabeling once the relabel work (BETA per
+ * relabel plus the arcs scanned) exceeds ALPHA * nn + na.
+ */
+#define GR_ALPHA 6
+#define GR_BETA 12
+
+/* State of one push-relabel phase; heights are `0 .. n-1`, `n` = cut off. */
+typedef struct {
+  FlowNetwork *f;
+  int n;
+  int target;   /* vertex the excess flows to */
+  int excluded; /* vertex that takes no part (keeps height n) */
+  int *h;
+  long long *excess;
+  long *cur;                  /* current arc */
+  int *aHead, *aNext;         /* active vertices, by height */
+  int *bHead, *bNext, *bPrev; /* every labelled vertex, by height */
+  int *queue;
+  int maxActive, maxH;
+  long work;
+} PushRelabel;
+
+// ---------------------- Construction ----------------------
+/*
+ * Pairs every arc `u[i] -> v[i]` of capacity `c[i]` (1 if `c` is NULL) with
+ * a reverse arc of capacity `c[i]` when `symmetric`, 0 otherwise. Self-loops
+ * carry no flow and are dropped.
+ */
+static FlowNetwork *network_build(int nn, long m, const int *u, const int *v,
+                                  const int *c, int symmetric) {
+  for (long i = 0; i < m; i++) {
+    if (u[i] < 0 || u[i] >= nn || v[i] < 0 || v[i] >= nn ||
+        (c && c[i] < 0)) {
+      fprintf(stderr, "Invalid flow edge %d - %d.\n", u[i], v[i]);
+      return NULL;
+    }
+  }
+
+  FlowNetwork *f = (FlowNetwork *)calloc(1, sizeof(FlowNetwork));
+  if (!f)
+    return NULL;
+  f->nn = nn;
+  f->off = (long *)calloc((size_t)nn + 1, sizeof(long));
+  if (!f->off) {
+    flow_network_free(f);
+    return NULL;
+  }
+
+  for (long i = 0; i < m; i++) {
+    if (u[i] != v[i]) {
+      f->off[u[i] + 1]++;
+      f->off[v[i] + 1]++;
+    }
+  }
+  for (int x = 0; x < nn; x++)
+    f->off[x + 1] += f->off[x];
+  f->na = f->off[nn];
+
+  size_t na = f->na > 0 ? (size_t)f->na : 1;
+  f->from = (int *)malloc(na * sizeof(int));
+  f->to = (int *)malloc(na * sizeof(int));
+  f->rev = (long *)malloc(na * sizeof(long));
+  f->cap = (long long *)malloc(na * sizeof(long long));
+  f->orig = (int *)malloc(na * sizeof(int));
+  long *pos = (long *)malloc(((size_t)nn + 1) * sizeof(long));
+  if (!f->from || !f->to || !f->rev || !f->cap || !f->orig || !pos) {
+    fprintf(stderr, "Memory allocation failed for flow network.\n");
+    free(pos);
+    flow_network_free(f);
+    return NULL;
+  }
+
+  memcpy(pos, f->off, ((size_t)nn + 1) * sizeof(long));
+  for (long i = 0; i < m; i++) {
+    if (u[i] == v[i])
+      continue;
+    long a = pos[u[i]]++, b = pos[v[i]]++;
+    int capacity = c ? c[i] : 1;
+    f->from[a] = u[i];
+    f->to[a] = v[i];
+    f->from[b] = v[i];
+    f->to[b] = u[i];
+    f->rev[a] = b;
+    f->rev[b] = a;
+    f->orig[a] = capacity;
+    f->orig[b] = symmetric ? capacity : 0;
+  }
+
+  free(pos);
+  flow_network_reset(f);
+  return f;
+}
+
+FlowNetwork *flow_network_from_graph(const TGraphL *G) {
+  if (!G)
+    return NULL;
+
+  long m = 0;
+  for (int x = 0; x < G->nn; x++)
+    for (TNode *nod = G->adl[x]; nod; nod = nod->next)
+      m++;
+
+  size_t len = m > 0 ? (size_t)m : 1;
+  int *u = (int *)malloc(len * sizeof(int));
+  int *v = (int *)malloc(len * sizeof(int));
+  int *c = (int *)malloc(len * sizeof(int));
+  FlowNetwork *f = NULL;
+  if (!u || !v || !c) {
+    fprintf(stderr, "Memory allocation failed for flow network.\n");
+  } else {
+    long i = 0;
+    for (int x = 0; x < G->nn; x++) {
+      for (TNode *nod = G->adl[x]; nod; nod = nod->next, i++) {
+        u[i] = x;
+        v[i] = nod->v;
+        c[i] = nod->c;
+      }
+    }
+    f = network_build(G->nn, m, u, v, c, 0);
+  }
+
+  free(u);
+  free(v);
+  free(c);
+  return f;
+}
+
+FlowNetwork *flow_network_from_edges(const EdgeList *el) {
+  if (!el)
+    return NULL;
+  return network_build(el->nn, el->ne, el->src, el->dst,
+                       el->weighted ? el->cost : NULL, !el->directed);
+}
+
+void flow_network_reset(FlowNetwork *f) {
+  if (!f)
+    return;
+  for (long k = 0; k < f->na; k++)
+    f->cap[k] = f->orig[k];
+}
+
+void flow_network_free(FlowNetwork *f) {
+  if (!f)
+    return;
+  free(f->off);
+  free(f->from);
+  free(f->to);
+  free(f->rev);
+  free(f->cap);
+  free(f->orig);
+  free(f);
+}
+
+// ---------------------- Dinic ----------------------
+/* BFS levels from `s` over residual arcs; returns 1 if `t` was reached. */
+static int dinic_levels(const FlowNetwork *f, int s, int t, int *level,
+                        int *queue) {
+  for (int v = 0; v < f->nn; v++)
+    level[v] = -1;
+
+  int head = 0, tail = 0;
+  level[s] = 0;
+  queue[tail++] = s;
+  while (head < tail) {
+    int u = queue[head++];
+    // Vertices at t's level or beyond are never on a shortest path
+    if (level[t] >= 0 && level[u] >= level[t])
+      break;
+    for (long k = f->off[u]; k < f->off[u + 1]; k++) {
+      if (f->cap[k] > 0 && level[f->to[k]] < 0) {
+        level[f->to[k]] = level[u] + 1;
+        queue[tail++] = f->to[k];
+      }
+    }
+  }
+  return level[t] >= 0;
+}
+
+long long max_flow_dinic(FlowNetwork *f, int s, int t) {
+  if (!f || s < 0 || s >= f->nn || t < 0 || t >= f->nn || s == t)
+    return -1;
+
+  int n = f->nn;
+  int *level = (int *)malloc(n * sizeof(int));
+  int *queue = (int *)malloc(n * sizeof(int));
+  long *it = (long *)malloc(((size_t)n + 1) * sizeof(long));
+  long *path = (long *)malloc(n * sizeof(long));
+  if (!level || !queue || !it || !path) {
+    fprintf(stderr, "Memory allocation failed for Dinic.\n");
+    free(level);
+    free(queue);
+    free(it);
+    free(path);
+    return -1;
+  }
+
+  long long total = 0;
+  while (dinic_levels(f, s, t, level, queue)) {
+    memcpy(it, f->off, ((size_t)n + 1) * sizeof(long));
+
+    // Blocking flow: `path` holds the arcs s -> u, `it` skips dead arcs
+    int u = s, depth = 0;
+    for (;;) {
+      if (u == t) {
+        long long b = LLONG_MAX;
+        for (int i = 0; i < depth; i++)
+          if (f->cap[path[i]] < b)
+            b = f->cap[path[i]];
+
+        int first = -1;
+        for (int i = 0; i < depth; i++) {
+          f->cap[path[i]] -= b;
+          f->cap[f->rev[path[i]]] += b;
+          if (first < 0 && f->cap[path[i]] == 0)
+            first = i;
+        }
+        total += b;
+
+        // Resume from the tail of the first saturated arc
+        depth = first;
+        u = f->from[path[first]];
+        continue;
+      }
+
+      long k = it[u];
+      while (k < f->off[u + 1] &&
+             (f->cap[k] == 0 || level[f->to[k]] != level[u] + 1))
+        k++;
+      it[u] = k;
+
+      if (k < f->off[u + 1]) {
+        path[depth++] = k;
+        u = f->to[k];
+        continue;
+      }
+
+      // Dead end: drop u from the level graph and retreat
+      level[u] = -1;
+      if (depth == 0)
+        break;
+      k = path[--depth];
+      u = f->from[k];
+      it[u]++;
+    }
+  }
+
+  free(level);
+  free(queue);
+  free(it);
+  free(path);
+  return total;
+}
+
+// ---------------------- Push-Relabel ----------------------
+static void bucket_insert(PushRelabel *pr, int v) {
+  int h = pr->h[v];
+  pr->bNext[v] = pr->bHead[h];
+  pr->bPrev[v] = -1;
+  if (pr->bHead[h] >= 0)
+    pr->bPrev[pr->bHead[h]] = v;
+  pr->bHead[h] = v;
+  if (h > pr->maxH)
+    pr->maxH = h;
+}
+
+static void bucket_remove(PushRelabel *pr, int v) {
+  if (pr->bPrev[v] >= 0)
+    pr->bNext[pr->bPrev[v]] = pr->bNext[v];
+  else
+    pr->bHead[pr->h[v]] = pr->bNext[v];
+  if (pr->bNext[v] >= 0)
+    pr->bPrev[pr->bNext[v]] = pr->bPrev[v];
+}
+
+static void activate(PushRelabel *pr, int v) {
+  int h = pr->h[v];
+  pr->aNext[v] = pr->aHead[h];
+  pr->aHead[h] = v;
+  if (h > pr->maxActive)
+    pr->maxActive = h;
+}
+
+/*
+ * Sets every height to the exact residual distance to the target (n if it
+ * cannot be reached) and rebuilds the buckets.
+ */
+static void global_relabel(PushRelabel *pr) {
+  FlowNetwork *f = pr->f;
+  int n = pr->n;
+  for (int v = 0; v < n; v++) {
+    pr->h[v] = n;
+    pr->aHead[v] = -1;
+    pr->bHead[v] = -1;
+  }
+  pr->maxActive = -1;
+  pr->maxH = -1;
+  pr->work = 0;
+
+  int head = 0, tail = 0;
+  pr->h[pr->target] = 0;
+  pr->queue[tail++] = pr->target;
+  while (head < tail) {
+    int v = pr->queue[head++];
+    for (long k = f->off[v]; k < f->off[v + 1]; k++) {
+      int w = f->to[k];
+      if (pr->h[w] == n && w != pr->excluded && f->cap[f->rev[k]] > 0) {
+        pr->h[w] = pr->h[v] + 1;
+        pr->queue[tail++] = w;
+      }
+    }
+  }
+
+  for (int i = 1; i < tail; i++) {
+    int v = pr->queue[i];
+    pr->cur[v] = f->off[v];
+    bucket_insert(pr, v);
+    if (pr->excess[v] > 0)
+      activate(pr, v);
+  }
+}
+
+/* Every vertex above the emptied height `h0` can no longer reach the target. */
+static void gap(PushRelabel *pr, int h0) {
+  for (int h = h0 + 1; h <= pr->maxH; h++) {
+    for (int v = pr->bHead[h]; v >= 0; v = pr->bNext[v])
+      pr->h[v] = pr->n;
+    pr->bHead[h] = -1;
+  }
+  pr->maxH = h0 - 1;
+}
+
+/* Pushes the excess of `u` along admissible arcs, relabeling as needed. */
+static void discharge(PushRelabel *pr, int u) {
+  FlowNetwork *f = pr->f;
+  int n = pr->n;
+
+  while (pr->excess[u] > 0) {
+    long k = pr->cur[u], end = f->off[u + 1];
+    for (; k < end; k++) {
+      int w = f->to[k];
+      if (f->cap[k] == 0 || pr->h[w] != pr->h[u] - 1)
+        continue;
+
+      long long d = pr->excess[u] < f->cap[k] ? pr->excess[u] : f->cap[k];
+      f->cap[k] -= d;
+      f->cap[f->rev[k]] += d;
+      pr->excess[u] -= d;
+      if (pr->excess[w] == 0 && w != pr->target)
+        activate(pr, w);
+      pr->excess[w] += d;
+      if (pr->excess[u] == 0)
+        break;
+    }
+    pr->cur[u] = k;
+    if (pr->excess[u] == 0)
+      return;
+
+    // Relabel; if u was alone at its height the gap cuts off everything above
+    int h0 = pr->h[u];
+    bucket_remove(pr, u);
+    if (pr->bHead[h0] < 0) {
+      gap(pr, h0);
+      pr->h[u] = n;
+      return;
+    }
+
+    int nh = n;
+    for (k = f->off[u]; k < end; k++) {
+      if (f->cap[k] > 0 && pr->h[f->to[k]] + 1 < nh) {
+        nh = pr->h[f->to[k]] + 1;
+        pr->cur[u] = k;
+      }
+    }
+    pr->work += GR_BETA + (end - f->off[u]);
+    pr->h[u] = nh;
+    if (nh >= n)
+      return;
+    bucket_insert(pr, u);
+  }
+}
+
+/* Discharges active vertices, highest first, until none reaches the target. */
+static void push_relabel_phase(PushRelabel *pr, int target, int excluded) {
+  pr->target = target;
+  pr->excluded = excluded;
+  global_relabel(pr);
+
+  long limit = (long)GR_ALPHA * pr->n + pr->f->na;
+  while (pr->maxActive >= 0) {
+    int u = pr->aHead[pr->maxActive];
+    if (u < 0) {
+      pr->maxActive--;
+      continue;
+    }
+    pr->aHead[pr->maxActive] = pr->aNext[u];
+
+    discharge(pr, u);
+    if (pr->work > limit)
+      global_relabel(pr);
+  }
+}
+
+long long max_flow_push_relabel(FlowNetwork *f, int s, int t) {
+  if (!f || s < 0 || s >= f->nn || t < 0 || t >= f->nn || s == t)
+    return -1;
+
+  int n = f->nn;
+  PushRelabel pr = {f, n, t, s, NULL, NULL, NULL, NULL, NULL,
+                    NULL, NULL, NULL, NULL, -1, -1, 0};
+  pr.h = (int *)malloc(n * sizeof(int));
+  pr.excess = (long long *)calloc(n, sizeof(long long));
+  pr.cur = (long *)malloc(n * sizeof(long));
+  pr.aHead = (int *)malloc(n * sizeof(int));
+  pr.aNext = (int *)malloc(n * sizeof(int));
+  pr.bHead = (int *)malloc(n * sizeof(int));
+  pr.bNext = (int *)malloc(n * sizeof(int));
+  pr.bPrev = (int *)malloc(n * sizeof(int));
+  pr.queue = (int *)malloc(n * sizeof(int));
+
+  long long flow = -1;
+  if (!pr.h || !pr.excess || !pr.cur || !pr.aHead || !pr.aNext ||
+      !pr.bHead || !pr.bNext || !pr.bPrev || !pr.queue) {
+    fprintf(stderr, "Memory allocation failed for push-relabel.\n");
+  } else {
+    // Saturate the source arcs, push to t, then return what is left to s
+    for (long k = f->off[s]; k < f->off[s + 1]; k++) {
+      pr.excess[f->to[k]] += f->cap[k];
+      f->cap[f->rev[k]] += f->cap[k];
+      f->cap[k] = 0;
+    }
+    push_relabel_phase(&pr, t, s);
+    flow = pr.excess[t];
+    push_relabel_phase(&pr, s, t);
+  }
+
+  free(pr.h);
+  free(pr.excess);
+  free(pr.cur);
+  free(pr.aHead);
+  free(pr.aNext);
+  free(pr.bHead);
+  free(pr.bNext);
+  free(pr.bPrev);
+  free(pr.queue);
+  return flow;
+}
+
+// ---------------------- Minimum Cut ----------------------
+long min_cut(const FlowNetwork *f, int t, char *side, long *cut) {
+  if (!f || !side || t < 0 || t >= f->nn)
+    return -1;
+
+  int *queue = (int *)malloc(f->nn * sizeof(int));
+  if (!queue) {
+    fprintf(stderr, "Memory allocation failed for minimum cut.\n");
+    return -1;
+  }
+
+  // Sink side: vertices with a residual path to t
+  memset(side, 1, f->nn);
+  int head = 0, tail = 0;
+  side[t] = 0;
+  queue[tail++] = t;
+  while (head < tail) {
+    int v = queue[head++];
+    for (long k = f->off[v]; k < f->off[v + 1]; k++) {
+      int w = f->to[k];
+      if (side[w] && f->cap[f->rev[k]] > 0) {
+        side[w] = 0;
+        queue[tail++] = w;
+      }
+    }
+  }
+  free(queue);
+
+  long count = 0;
+  for (long k = 0; k < f->na; k++) {
+    if (side[f->from[k]] && !side[f->to[k]] && f->orig[k] > 0) {
+      if (cut)
+        cut[count] = k;
+      count++;
+    }
+  }
+  return count;
+}
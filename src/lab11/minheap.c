@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/minheap.h"
+
+APriQueue makeQueue(int capacity) {
+  if (capacity <= 0) {
+    fprintf(stderr, "Error: Capacity must be greater than zero.\n");
+    return NULL;
+  }
+
+  APriQueue h = (APriQueue)malloc(sizeof(PriQueue));
+  if (!h) {
+    fprintf(stderr, "Error: Memory allocation failed for priority queue.\n");
+    return NULL;
+  }
+
+  h->elem = (ItemType *)malloc(capacity * sizeof(ItemType));
+  if (!h->elem) {
+    fprintf(stderr, "Error: Memory allocation failed for heap elements.\n");
+    free(h);
+    return NULL;
+  }
+
+  h->capacity = capacity;
+  h->size = 0;
+  return h;
+}
+
+int getLeftChild(int i) { return 2 * i + 1; }
+int getRightChild(int i) { return 2 * i + 2; }
+int getParent(int i) { return (i - 1) / 2; }
+
+void siftUp(APriQueue h, int idx) {
+  int parent = getParent(idx);
+
+  while (parent >= 0 && h->elem[parent].prior > h->elem[idx].prior) {
+    ItemType aux = h->elem[parent];
+    h->elem[parent] = h->elem[idx];
+    h->elem[idx] = aux;
+
+    idx = parent;
+    parent = getParent(idx);
+  }
+}
+
+void insert(APriQueue h, ItemType x) {
+  if (!h) {
+    fprintf(stderr, "Error: Priority queue is NULL.\n");
+    return;
+  }
+
+  if (h->size == h->capacity) {
+    h->capacity *= 2;
+    ItemType *newElem =
+        (ItemType *)realloc(h->elem, h->capacity * sizeof(ItemType));
+    if (!newElem) {
+      fprintf(stderr,
+              "Error: Memory allocation failed during heap expansion.\n");
+      return;
+    }
+    h->elem = newElem;
+  }
+
+  h->elem[h->size] = x;
+  h->size++;
+  siftUp(h, h->size - 1);
+}
+
+ItemType getMin(APriQueue h) {
+  if (!h || h->size == 0) {
+    fprintf(stderr, "Error: Priority queue is empty.\n");
+    return (ItemType){0, 0};
+  }
+  return h->elem[0];
+}
+
+void siftDown(APriQueue h, int idx) {
+  int leftChild = getLeftChild(idx);
+  int rightChild = getRightChild(idx);
+  int smallest = idx;
+
+  if (leftChild < h->size &&
+      h->elem[leftChild].prior < h->elem[smallest].prior) {
+    smallest = leftChild;
+  }
+
+  if (rightChild < h->size &&
+      h->elem[rightChild].prior < h->elem[smallest].prior) {
+    smallest = rightChild;
+  }
+
+  if (smallest != idx) {
+    ItemType aux = h->elem[smallest];
+    h->elem[smallest] = h->elem[idx];
+    h->elem[idx] = aux;
+
+    siftDown(h, smallest);
+  }
+}
+
+ItemType removeMin(APriQueue h) {
+  if (!h || h->size == 0) {
+    fprintf(stderr, "Error: Cannot remove from empty priority queue.\n");
+    return (ItemType){0, 0};
+  }
+
+  ItemType min = getMin(h);
+  ItemType last = h->elem[h->size - 1];
+
+  h->size--;
+  h->elem[0] = last;
+  siftDown(h, 0);
+
+  return min;
+}
+
+void freeQueue(APriQueue h) {
+  if (!h)
+    return;
+  free(h->elem);
+  free(h);
+}
+
+/* ============================ INDEXED MIN-HEAP ============================ */
+
+AIndexedPriQueue makeIndexedQueue(int capacity) {
+  if (capacity <= 0) {
+    fprintf(stderr, "Error: Capacity must be greater than zero.\n");
+    return NULL;
+  }
+
+  AIndexedPriQueue h = (AIndexedPriQueue)malloc(sizeof(IndexedPriQueue));
+  if (!h) {
+    fprintf(stderr, "Error: Memory allocation failed for priority queue.\n");
+    return NULL;
+  }
+
+  h->heap = (int *)malloc(capacity * sizeof(int));
+  h->pos = (int *)malloc(capacity * sizeof(int));
+  h->key = (int *)malloc(capacity * sizeof(int));
+  if (!h->heap || !h->pos || !h->key) {
+    fprintf(stderr, "Error: Memory allocation failed for heap elements.\n");
+    free(h->heap);
+    free(h->pos);
+    free(h->key);
+    free(h);
+    return NULL;
+  }
+
+  for (int i = 0; i < capacity; i++)
+    h->pos[i] = -1;
+
+  h->capacity = capacity;
+  h->size = 0;
+  return h;
+}
+
+int containsIndexed(AIndexedPriQueue h, int id) {
+  return h && id >= 0 && id < h->capacity && h->pos[id] >= 0;
+}
+
+/* Moves the id at heap index `idx` up, shifting parents down into the hole. */
+static void siftUpIndexed(AIndexedPriQueue h, int idx) {
+  int id = h->heap[idx];
+  int k = h->key[id];
+
+  while (idx > 0) {
+    int parent = getParent(idx);
+    int pid = h->heap[parent];
+    if (h->key[pid] <= k)
+      break;
+    h->heap[idx] = pid;
+    h->pos[pid] = idx;
+    idx = parent;
+  }
+
+  h->heap[idx] = id;
+  h->pos[id] = idx;
+}
+
+/* Moves the id at heap index `idx` down, shifting children up into the hole. */
+static void siftDownIndexed(AIndexedPriQueue h, int idx) {
+  int id = h->heap[idx];
+  int k = h->key[id];
+
+  for (;;) {
+    int child = getLeftChild(idx);
+    if (child >= h->size)
+      break;
+    if (child + 1 < h->size &&
+        h->key[h->heap[child + 1]] < h->key[h->heap[child]])
+      child++;
+
+    int cid = h->heap[child];
+    if (h->key[cid] >= k)
+      break;
+    h->heap[idx] = cid;
+    h->pos[cid] = idx;
+    idx = child;
+  }
+
+  h->heap[idx] = id;
+  h->pos[id] = idx;
+}
+
+void insertIndexed(AIndexedPriQueue h, int id, int key) {
+  if (!h || id < 0 || id >= h->capacity || h->pos[id] >= 0) {
+    fprintf(stderr, "Error: Invalid insert into indexed priority queue.\n");
+    return;
+  }
+
+  h->key[id] = key;
+  h->heap[h->size] = id;
+  h->pos[id] = h->size;
+  h->size++;
+  siftUpIndexed(h, h->size - 1);
+}
+
+void decreaseKey(AIndexedPriQueue h, int id, int key) {
+  if (!containsIndexed(h, id) || key >= h->key[id])
+    return;
+
+  h->key[id] = key;
+  siftUpIndexed(h, h->pos[id]);
+}
+
+void changeKey(AIndexedPriQueue h, int id, int key) {
+  if (!containsIndexed(h, id))
+    return;
+
+  int old = h->key[id];
+  h->key[id] = key;
+  if (key < old)
+    siftUpIndexed(h, h->pos[id]);
+  else
+    siftDownIndexed(h, h->pos[id]);
+}
+
+ItemType getMinIndexed(AIndexedPriQueue h) {
+  if (!h || h->size == 0) {
+    fprintf(stderr, "Error: Priority queue is empty.\n");
+    return (ItemType){0, 0};
+  }
+  return (ItemType){h->heap[0], h->key[h->heap[0]]};
+}
+
+ItemType removeMinIndexed(AIndexedPriQueue h) {
+  if (!h || h->size == 0) {
+    fprintf(stderr, "Error: Cannot remove from empty priority queue.\n");
+    return (ItemType){0, 0};
+  }
+
+  int id = h->heap[0];
+  ItemType min = {id, h->key[id]};
+
+  h->pos[id] = -1;
+  h->size--;
+  if (h->size > 0) {
+    h->heap[0] = h->heap[h->size];
+    siftDownIndexed(h, 0);
+  }
+
+  return min;
+}
+
+void clearIndexedQueue(AIndexedPriQueue h) {
+  if (!h)
+    return;
+  for (int i = 0; i < h->size; i++)
+    h->pos[h->heap[i]] = -1;
+  h->size = 0;
+}
+
+void freeIndexedQueue(AIndexedPriQueue h) {
+  if (!h)
+    return;
+  free(h->heap);
+  free(h->pos);
+  free(h->key);
+  free(h);
+}
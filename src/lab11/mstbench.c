@@ -0,0 +1,105 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../common/include/graphio.h"
+#include "include/graph.h"
+#include "include/kruskal.h"
+
+/*
+ * Benchmarks Kruskal (parallel radix sort + union-find) against Prim on a
+ * sparse random connected graph: a random spanning tree plus uniformly
+ * random extra edges, costs in [0, 100000). Both totals must agree.
+ *
+ * Usage: mstbench [vertices] [edges]
+ */
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 7;
+  rngState ^= rngState << 17;
+  return (unsigned)(rngState >> 32);
+}
+
+static double nowMs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+  int nn = argc > 1 ? atoi(argv[1]) : 1000000;
+  long ne = argc > 2 ? atol(argv[2]) : 10000000;
+  if (nn < 2 || ne < nn - 1) {
+    fprintf(stderr, "Usage: %s [vertices >= 2] [edges >= vertices-1]\n",
+            argv[0]);
+    return 1;
+  }
+
+  EdgeList *el = createEdgeList(nn, ne, 0, 1);
+  if (!el)
+    return 1;
+
+  for (long i = 0; i < ne; i++) {
+    if (i < nn - 1) {
+      el->src[i] = (int)(rng() % (i + 1));
+      el->dst[i] = (int)(i + 1);
+    } else {
+      el->src[i] = rng() % nn;
+      el->dst[i] = rng() % nn;
+    }
+    el->cost[i] = rng() % 100000;
+  }
+  printf("%d vertices, %ld edges\n", nn, ne);
+
+  long *order = (long *)malloc(ne * sizeof(long));
+  long *mst = (long *)malloc(nn * sizeof(long)), count = 0;
+  if (!order || !mst)
+    return 1;
+
+  double t0 = nowMs();
+  sort_edges_by_cost(el, order);
+  double sortMs = nowMs() - t0;
+
+  int sorted = 1;
+  for (long i = 1; i < ne; i++)
+    if (el->cost[order[i - 1]] > el->cost[order[i]])
+      sorted = 0;
+
+  t0 = nowMs();
+  long long kTotal = kruskal_mst(el, mst, &count);
+  double kruskalMs = nowMs() - t0;
+
+  TGraphL G;
+  alloc_list_from_edges(&G, el);
+
+  int *P = (int *)malloc(nn * sizeof(int));
+  int *K = (int *)malloc(nn * sizeof(int));
+  if (!P || !K)
+    return 1;
+
+  t0 = nowMs();
+  long long pTotal = prim_mst(&G, P, K);
+  double primMs = nowMs() - t0;
+
+  printf("%-18s %10.1f ms  (%s)\n", "radix sort", sortMs,
+         sorted ? "sorted" : "NOT SORTED");
+  printf("%-18s %10.1f ms  weight %lld, %ld edges\n", "kruskal", kruskalMs,
+         kTotal, count);
+  printf("%-18s %10.1f ms  weight %lld\n", "prim", primMs, pTotal);
+
+  int ok = sorted && kTotal == pTotal && count == nn - 1;
+  printf("totals %s\n", ok ? "match" : "DIFFER");
+
+  free(P);
+  free(K);
+  free(order);
+  free(mst);
+  destroyGraphAdjList(&G);
+  freeEdgeList(el);
+  return ok ? 0 : 1;
+}
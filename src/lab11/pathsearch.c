@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/minheap.h"
+#include "include/pathsearch.h"
+
+/**
+ * Offers `v` the tentative distance `nd` through `u`, queueing it with
+ * priority `key` (the distance itself, or distance plus heuristic for A*).
+ */
+static void relax(SPWorkspace *ws, int u, int v, int nd, int key) {
+  if (ws->seen[v] != ws->stamp) {
+    ws->seen[v] = ws->stamp;
+    ws->dist[v] = nd;
+    ws->pred[v] = u;
+    insertIndexed(ws->heap, v, key);
+  } else if (nd < ws->dist[v]) {
+    ws->dist[v] = nd;
+    ws->pred[v] = u;
+    if (containsIndexed(ws->heap, v))
+      decreaseKey(ws->heap, v, key);
+    else
+      insertIndexed(ws->heap, v, key); // reopened by an inconsistent heuristic
+  }
+}
+
+static void start(SPWorkspace *ws, int s, int key) {
+  sp_begin(ws);
+  ws->source = s;
+  ws->settled = 0;
+  ws->seen[s] = ws->stamp;
+  ws->dist[s] = 0;
+  ws->pred[s] = -1;
+  insertIndexed(ws->heap, s, key);
+}
+
+// ---------------------- Bidirectional Dijkstra ----------------------
+int bidijkstra_query(const TGraphL *G, int s, int t, SPWorkspace *fwd,
+                     SPWorkspace *bwd, int *meet) {
+  int best = INF, join = -1;
+
+  if (!G || !fwd || !bwd || G->nn > fwd->nn || G->nn > bwd->nn || s < 0 ||
+      t < 0 || s >= G->nn || t >= G->nn) {
+    if (meet)
+      *meet = -1;
+    return INF;
+  }
+
+  start(fwd, s, 0);
+  start(bwd, t, 0);
+  if (s == t) {
+    best = 0;
+    join = s;
+  }
+
+  while (fwd->heap->size > 0 && bwd->heap->size > 0) {
+    int topF = getMinIndexed(fwd->heap).prior;
+    int topB = getMinIndexed(bwd->heap).prior;
+    if (topF + topB >= best)
+      break;
+
+    // Expand the side with the smaller frontier
+    SPWorkspace *ws = fwd->heap->size <= bwd->heap->size ? fwd : bwd;
+    SPWorkspace *other = ws == fwd ? bwd : fwd;
+
+    int u = removeMinIndexed(ws->heap).content;
+    ws->settled++;
+
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next) {
+      int v = nod->v;
+      int nd = ws->dist[u] + nod->c;
+      relax(ws, u, v, nd, nd);
+
+      if (other->seen[v] == other->stamp && nd + other->dist[v] < best) {
+        best = nd + other->dist[v];
+        join = v;
+      }
+    }
+  }
+
+  clearIndexedQueue(fwd->heap);
+  clearIndexedQueue(bwd->heap);
+
+  if (meet)
+    *meet = join;
+  return best;
+}
+
+int bidijkstra_path(const SPWorkspace *fwd, const SPWorkspace *bwd, int meet,
+                    int *path) {
+  if (meet < 0)
+    return 0;
+
+  int len = sp_path(fwd, meet, path);
+  for (int v = sp_pred(bwd, meet); v >= 0; v = sp_pred(bwd, v))
+    path[len++] = v;
+  return len;
+}
+
+// ---------------------- A* ----------------------
+int astar_query(const TGraphL *G, int s, int t, SPHeuristic h, void *ctx,
+                SPWorkspace *ws) {
+  if (!G || !ws || G->nn > ws->nn || s < 0 || t < 0 || s >= G->nn ||
+      t >= G->nn)
+    return INF;
+
+  start(ws, s, h ? h(s, t, ctx) : 0);
+
+  while (ws->heap->size > 0) {
+    int u = removeMinIndexed(ws->heap).content;
+    ws->settled++;
+    if (u == t)
+      break;
+
+    for (TNode *nod = G->adl[u]; nod; nod = nod->next) {
+      int v = nod->v;
+      int nd = ws->dist[u] + nod->c;
+      if (ws->seen[v] != ws->stamp || nd < ws->dist[v])
+        relax(ws, u, v, nd, nd + (h ? h(v, t, ctx) : 0));
+    }
+  }
+
+  clearIndexedQueue(ws->heap);
+  return sp_dist(ws, t);
+}
+
+// ---------------------- ALT Landmarks ----------------------
+ALTLandmarks *alt_build(TGraphL *G, int nl) {
+  if (!G || G->nn <= 0 || nl <= 0)
+    return NULL;
+  if (nl > G->nn)
+    nl = G->nn;
+
+  ALTLandmarks *alt = (ALTLandmarks *)malloc(sizeof(ALTLandmarks));
+  int *row = (int *)malloc(G->nn * sizeof(int));
+  int *closest = (int *)malloc(G->nn * sizeof(int));
+  if (!alt || !row || !closest) {
+    fprintf(stderr, "Memory allocation failed for landmarks.\n");
+    free(alt);
+    free(row);
+    free(closest);
+    return NULL;
+  }
+
+  alt->nn = G->nn;
+  alt->nl = nl;
+  alt->landmark = (int *)malloc(nl * sizeof(int));
+  alt->dist = (int *)malloc((size_t)nl * G->nn * sizeof(int));
+  if (!alt->landmark || !alt->dist) {
+    fprintf(stderr, "Memory allocation failed for landmarks.\n");
+    free(row);
+    free(closest);
+    alt_free(alt);
+    return NULL;
+  }
+
+  // The first landmark is the vertex farthest from 0; every next one is the
+  // reachable vertex farthest from all landmarks chosen so far
+  int failed = dijkstra_queue(G, 0, QUEUE_BINARY_HEAP, closest) != 0;
+
+  for (int l = 0; l < nl && !failed; l++) {
+    int far = 0;
+    for (int v = 0; v < G->nn; v++)
+      if (closest[v] != INF && closest[v] > closest[far])
+        far = v;
+
+    alt->landmark[l] = far;
+    if (dijkstra_queue(G, far, QUEUE_BINARY_HEAP, row) != 0) {
+      failed = 1;
+      break;
+    }
+
+    for (int v = 0; v < G->nn; v++) {
+      alt->dist[(size_t)v * nl + l] = row[v];
+      if (l == 0 || row[v] < closest[v])
+        closest[v] = row[v];
+    }
+  }
+
+  free(row);
+  free(closest);
+  if (failed) {
+    alt_free(alt);
+    return NULL;
+  }
+  return alt;
+}
+
+int alt_heuristic(int v, int t, void *ctx) {
+  ALTLandmarks *alt = (ALTLandmarks *)ctx;
+  const int *dv = alt->dist + (size_t)v * alt->nl;
+  const int *dt = alt->dist + (size_t)t * alt->nl;
+
+  int best = 0;
+  for (int l = 0; l < alt->nl; l++) {
+    if (dv[l] == INF || dt[l] == INF)
+      continue;
+    int diff = dt[l] > dv[l] ? dt[l] - dv[l] : dv[l] - dt[l];
+    if (diff > best)
+      best = diff;
+  }
+  return best;
+}
+
+void alt_free(ALTLandmarks *alt) {
+  if (!alt)
+    return;
+  free(alt->landmark);
+  free(alt->dist);
+  free(alt);
+}
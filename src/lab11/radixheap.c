@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/radixheap.h"
+
+static int radixBucketOf(unsigned last, int key) {
+  unsigned diff = (unsigned)key ^ last;
+  return diff ? 32 - __builtin_clz(diff) : 0;
+}
+
+static void linkRadix(ARadixHeap h, int id, int b) {
+  h->bucket[id] = b;
+  h->prev[id] = -1;
+  h->next[id] = h->head[b];
+  if (h->head[b] >= 0)
+    h->prev[h->head[b]] = id;
+  h->head[b] = id;
+}
+
+static void unlinkRadix(ARadixHeap h, int id) {
+  int b = h->bucket[id];
+  if (h->prev[id] >= 0)
+    h->next[h->prev[id]] = h->next[id];
+  else
+    h->head[b] = h->next[id];
+  if (h->next[id] >= 0)
+    h->prev[h->next[id]] = h->prev[id];
+  h->bucket[id] = -1;
+}
+
+ARadixHeap makeRadixHeap(int capacity) {
+  if (capacity <= 0) {
+    fprintf(stderr, "Error: Capacity must be greater than zero.\n");
+    return NULL;
+  }
+
+  ARadixHeap h = (ARadixHeap)malloc(sizeof(RadixHeap));
+  if (!h) {
+    fprintf(stderr, "Error: Memory allocation failed for radix heap.\n");
+    return NULL;
+  }
+
+  h->capacity = capacity;
+  h->size = 0;
+  h->last = 0;
+  h->next = (int *)malloc(capacity * sizeof(int));
+  h->prev = (int *)malloc(capacity * sizeof(int));
+  h->key = (int *)malloc(capacity * sizeof(int));
+  h->bucket = (int *)malloc(capacity * sizeof(int));
+  if (!h->next || !h->prev || !h->key || !h->bucket) {
+    fprintf(stderr, "Error: Memory allocation failed for radix buckets.\n");
+    freeRadixHeap(h);
+    return NULL;
+  }
+
+  for (int b = 0; b < RADIX_BUCKETS; b++)
+    h->head[b] = -1;
+  for (int i = 0; i < capacity; i++)
+    h->bucket[i] = -1;
+
+  return h;
+}
+
+void insertRadix(ARadixHeap h, int id, int key) {
+  if (!h || id < 0 || id >= h->capacity || h->bucket[id] >= 0 || key < 0 ||
+      (unsigned)key < h->last) {
+    fprintf(stderr, "Error: Invalid insert into radix heap.\n");
+    return;
+  }
+
+  h->key[id] = key;
+  linkRadix(h, id, radixBucketOf(h->last, key));
+  h->size++;
+}
+
+void decreaseKeyRadix(ARadixHeap h, int id, int key) {
+  if (!h || id < 0 || id >= h->capacity || h->bucket[id] < 0 ||
+      key >= h->key[id] || key < 0 || (unsigned)key < h->last)
+    return;
+
+  unlinkRadix(h, id);
+  h->key[id] = key;
+  linkRadix(h, id, radixBucketOf(h->last, key));
+}
+
+int removeMinRadix(ARadixHeap h, int *key) {
+  if (!h || h->size == 0) {
+    fprintf(stderr, "Error: Cannot remove from empty radix heap.\n");
+    return -1;
+  }
+
+  if (h->head[0] < 0) {
+    int b = 1;
+    while (h->head[b] < 0)
+      b++;
+
+    // The new `last` is the smallest key of the first non-empty bucket;
+    // every id of that bucket then falls into a strictly lower bucket
+    int min = h->head[b];
+    for (int id = h->next[min]; id >= 0; id = h->next[id]) {
+      if (h->key[id] < h->key[min])
+        min = id;
+    }
+    h->last = (unsigned)h->key[min];
+
+    int id = h->head[b];
+    h->head[b] = -1;
+    while (id >= 0) {
+      int next = h->next[id];
+      linkRadix(h, id, radixBucketOf(h->last, h->key[id]));
+      id = next;
+    }
+  }
+
+  int id = h->head[0];
+  unlinkRadix(h, id);
+  if (key)
+    *key = h->key[id];
+  h->size--;
+
+  return id;
+}
+
+void freeRadixHeap(ARadixHeap h) {
+  if (!h)
+    return;
+  free(h->next);
+  free(h->prev);
+  free(h->key);
+  free(h->bucket);
+  free(h);
+}
@@ -0,0 +1,243 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../common/include/csr.h"
+#include "../common/include/graphgen.h"
+#include "../common/include/reorder.h"
+#include "include/graph.h"
+
+/*
+ * Benchmarks vertex reordering on a road-like grid, an R-MAT graph and a
+ * directed R-MAT graph. The generated ids are first shuffled at random (ids
+ * as they come out of an arbitrary input file), then renumbered by decreasing
+ * degree, BFS order and RCM; each result must be a permutation. Every
+ * ordering is timed with `dijkstra` (binary heap) on adjacency lists built
+ * from the renumbered edge list and a plain BFS on the renumbered CSR graph,
+ * both from the same logical source. Ordering time covers
+ * `computeOrdering` and `permuteEdgeList`. The distances, mapped back to the
+ * shuffled ids, must be identical.
+ *
+ * Usage: reorderbench [V=1048576] [queries=3]
+ */
+
+#define AVG_DEGREE 8
+#define MAX_COST 1000
+#define SEED 11
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 7;
+  rngState ^= rngState << 17;
+  return (unsigned)(rngState >> 32);
+}
+
+static double nowMs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+/* Plain single-source BFS over the CSR arcs, `queue` holds nn entries. */
+static void csr_bfs(const CsrGraph *g, int s, int *dist, int *queue) {
+  for (int v = 0; v < g->nn; v++)
+    dist[v] = -1;
+
+  int head = 0, tail = 0;
+  dist[s] = 0;
+  queue[tail++] = s;
+  while (head < tail) {
+    int u = queue[head++];
+    for (long k = g->off[u]; k < g->off[u + 1]; k++) {
+      if (dist[g->adj[k]] < 0) {
+        dist[g->adj[k]] = dist[u] + 1;
+        queue[tail++] = g->adj[k];
+      }
+    }
+  }
+}
+
+/* Checks that `perm` holds every id of `0 .. n - 1` once (`seen`: n ints). */
+static int is_permutation(const int *perm, int n, int *seen) {
+  for (int v = 0; v < n; v++)
+    seen[v] = 0;
+  for (int v = 0; v < n; v++) {
+    if (perm[v] < 0 || perm[v] >= n || seen[perm[v]])
+      return 0;
+    seen[perm[v]] = 1;
+  }
+  return 1;
+}
+
+static EdgeList *copy_edges(const EdgeList *el) {
+  EdgeList *c = createEdgeList(el->nn, el->ne, el->directed, el->weighted);
+  if (!c)
+    return NULL;
+  memcpy(c->src, el->src, el->ne * sizeof(int));
+  memcpy(c->dst, el->dst, el->ne * sizeof(int));
+  if (el->weighted)
+    memcpy(c->cost, el->cost, el->ne * sizeof(int));
+  return c;
+}
+
+/* Largest |u - v| over the arcs: how far apart neighbours are stored. */
+static long bandwidth(const CsrGraph *g) {
+  long bw = 0;
+  for (int u = 0; u < g->nn; u++)
+    for (long k = g->off[u]; k < g->off[u + 1]; k++)
+      if (labs((long)g->adj[k] - u) > bw)
+        bw = labs((long)g->adj[k] - u);
+  return bw;
+}
+
+/*
+ * Times one ordering of `base` (`method < 0` keeps the ids). The distances
+ * from `sources` are mapped back and compared with `ref` (filled on the
+ * first call, `*have_ref == 0`).
+ */
+static int run_ordering(const char *name, const EdgeList *base,
+                        const CsrGraph *baseCsr, int method, const int *sources,
+                        int queries, int *ref, int *have_ref) {
+  int nn = base->nn;
+  EdgeList *el = copy_edges(base);
+  int *perm = (int *)malloc(nn * sizeof(int));
+  int *dist = (int *)malloc(nn * sizeof(int));
+  int *hops = (int *)malloc(nn * sizeof(int));
+  int *queue = (int *)malloc(nn * sizeof(int));
+  if (!el || !perm || !dist || !hops || !queue) {
+    fprintf(stderr, "Memory allocation failed for benchmark buffers.\n");
+    return 0;
+  }
+
+  // Both structures are renumbered: lists from the edge list, CSR directly
+  double orderMs = 0;
+  if (method >= 0) {
+    double t0 = nowMs();
+    if (computeOrdering(baseCsr, (ReorderMethod)method, perm) != 0)
+      return 0;
+    if (!is_permutation(perm, nn, hops)) {
+      fprintf(stderr, "The %s ordering is not a permutation.\n", name);
+      return 0;
+    }
+    if (permuteEdgeList(el, perm) != 0)
+      return 0;
+    orderMs = nowMs() - t0;
+  } else {
+    for (int v = 0; v < nn; v++)
+      perm[v] = v;
+  }
+
+  TGraphL G;
+  alloc_list_from_edges(&G, el);
+  CsrGraph *csr = permuteCsr(baseCsr, perm);
+  if (!csr)
+    return 0;
+
+  int ok = 1;
+  double dijMs = 0, bfsMs = 0;
+  for (int q = 0; q < queries; q++) {
+    int s = perm[sources[q]];
+    double t0 = nowMs();
+    ok &= dijkstra_queue(&G, s, QUEUE_BINARY_HEAP, dist) == 0;
+    dijMs += nowMs() - t0;
+
+    t0 = nowMs();
+    csr_bfs(csr, s, hops, queue);
+    bfsMs += nowMs() - t0;
+
+    // Back to the shuffled ids: orig[v] = res[perm[v]]
+    int *r = ref + (size_t)2 * q * nn;
+    for (int v = 0; v < nn; v++) {
+      if (!*have_ref) {
+        r[v] = dist[perm[v]];
+        r[nn + v] = hops[perm[v]];
+      } else if (r[v] != dist[perm[v]] || r[nn + v] != hops[perm[v]]) {
+        ok = 0;
+      }
+    }
+  }
+  *have_ref = 1;
+
+  printf("%-10s %10.1f %10ld %14.1f %14.1f\n", name, orderMs, bandwidth(csr),
+         dijMs / queries, bfsMs / queries);
+
+  freeCsr(csr);
+  destroyGraphAdjList(&G);
+  freeEdgeList(el);
+  free(perm);
+  free(dist);
+  free(hops);
+  free(queue);
+  return ok;
+}
+
+static int run_case(GraphGenKind kind, int nn, int directed, int queries) {
+  EdgeList *el = generateGraph(kind, nn, (long)nn * AVG_DEGREE, directed,
+                               MAX_COST, SEED);
+  int *shuffle = el ? (int *)malloc(el->nn * sizeof(int)) : NULL;
+  int *sources = (int *)malloc(queries * sizeof(int));
+  int *ref = el ? (int *)malloc((size_t)2 * queries * el->nn * sizeof(int))
+                : NULL;
+  if (!shuffle || !sources || !ref) {
+    fprintf(stderr, "Memory allocation failed for benchmark buffers.\n");
+    return 0;
+  }
+
+  // Random ids, as an input file in no particular order would give
+  for (int v = 0; v < el->nn; v++)
+    shuffle[v] = v;
+  for (int v = el->nn - 1; v > 0; v--) {
+    int j = rng() % (v + 1), t = shuffle[v];
+    shuffle[v] = shuffle[j];
+    shuffle[j] = t;
+  }
+  if (permuteEdgeList(el, shuffle) != 0)
+    return 0;
+  for (int q = 0; q < queries; q++)
+    sources[q] = el->src[rng() % el->ne];
+
+  printf("\n%s%s: %d vertices, %ld edges\n", graphGenName(kind),
+         directed ? " (directed)" : "", el->nn, el->ne);
+  printf("%-10s %10s %10s %14s %14s\n", "ordering", "order ms", "bandwidth",
+         "dijkstra ms/q", "csr bfs ms/q");
+
+  CsrGraph *csr = buildCsr(el);
+  if (!csr)
+    return 0;
+
+  const char *names[] = {"shuffled", "degree", "bfs", "rcm"};
+  const int methods[] = {-1, REORDER_DEGREE, REORDER_BFS, REORDER_RCM};
+  int ok = 1, have_ref = 0;
+  for (int m = 0; m < 4; m++)
+    ok &= run_ordering(names[m], el, csr, methods[m], sources, queries, ref,
+                       &have_ref);
+
+  free(shuffle);
+  free(sources);
+  free(ref);
+  freeCsr(csr);
+  freeEdgeList(el);
+  return ok;
+}
+
+int main(int argc, char *argv[]) {
+  int nn = argc > 1 ? atoi(argv[1]) : 1048576;
+  int queries = argc > 2 ? atoi(argv[2]) : 3;
+  if (nn < 4 || queries <= 0) {
+    fprintf(stderr, "Usage: %s [V >= 4] [queries]\n", argv[0]);
+    return 1;
+  }
+
+  int ok = run_case(GRAPHGEN_GRID, nn, 0, queries);
+  ok &= run_case(GRAPHGEN_RMAT, nn, 0, queries);
+  ok &= run_case(GRAPHGEN_RMAT, nn, 1, queries);
+
+  printf(ok ? "\nreordered distances match\n"
+            : "\nreordered distances DIFFER\n");
+  return ok ? 0 : 1;
+}
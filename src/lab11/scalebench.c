@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../common/include/benchrun.h"
+#include "../common/include/graphgen.h"
+#include "include/graph.h"
+
+/*
+ * Scale benchmark of `dijkstra` (binary heap) and `Prim` on synthetic
+ * undirected graphs (Erdos-Renyi, R-MAT, grid) of doubling size, AVG_DEGREE
+ * edges per vertex, costs in [1, MAX_COST]. Dijkstra starts from the first
+ * edge's endpoint so the source is never isolated. Prints CSV (see
+ * benchrun.h) to stdout.
+ *
+ * Usage: scalebench [maxV=131072]
+ */
+
+#define MIN_V 1024
+#define AVG_DEGREE 8
+#define MAX_COST 1000
+#define SEED 42
+
+typedef struct {
+  TGraphL *G;
+  int source;
+} ScaleCtx;
+
+static void run_dijkstra(void *ctx) {
+  ScaleCtx *sc = (ScaleCtx *)ctx;
+  int *dist = (int *)malloc(sc->G->nn * sizeof(int));
+  if (dist && dijkstra_queue(sc->G, sc->source, QUEUE_BINARY_HEAP, dist) != 0)
+    fprintf(stderr, "Dijkstra failed during the scaling run.\n");
+  free(dist);
+}
+
+static void run_prim(void *ctx) {
+  ScaleCtx *sc = (ScaleCtx *)ctx;
+  int *P = (int *)malloc(sc->G->nn * sizeof(int));
+  int *K = (int *)malloc(sc->G->nn * sizeof(int));
+  if (P && K)
+    prim_mst(sc->G, P, K);
+  free(P);
+  free(K);
+}
+
+int main(int argc, char *argv[]) {
+  int maxV = argc > 1 ? atoi(argv[1]) : 131072;
+  if (maxV < MIN_V) {
+    fprintf(stderr, "Usage: %s [maxV >= %d]\n", argv[0], MIN_V);
+    return 1;
+  }
+
+  const GraphGenKind kinds[] = {GRAPHGEN_ERDOS_RENYI, GRAPHGEN_RMAT,
+                                GRAPHGEN_GRID};
+  int failures = 0;
+
+  benchCsvHeader(stdout);
+  for (int k = 0; k < 3; k++) {
+    for (int nn = MIN_V; nn <= maxV; nn *= 2) {
+      EdgeList *el = generateGraph(kinds[k], nn, (long)nn * AVG_DEGREE, 0,
+                                   MAX_COST, SEED);
+      if (!el)
+        return 1;
+
+      TGraphL G;
+      alloc_list_from_edges(&G, el);
+
+      ScaleCtx ctx = {&G, el->src[0]};
+      BenchCase bc = {"lab11", "dijkstra", graphGenName(kinds[k]), el->nn,
+                      el->ne};
+      failures += benchRun(stdout, &bc, run_dijkstra, &ctx) != 0;
+      bc.algorithm = "Prim";
+      failures += benchRun(stdout, &bc, run_prim, &ctx) != 0;
+
+      destroyGraphAdjList(&G);
+      freeEdgeList(el);
+    }
+  }
+
+  return failures ? 1 : 0;
+}
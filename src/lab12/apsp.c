@@ -0,0 +1,407 @@
+#include <limits.h>
+#include <stddef.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "include/apsp.h"
+
+/**
+ * Entry of the lazy binary heap used by the Dijkstra runs.
+ */
+typedef struct heapItem {
+    int key, v;
+} HeapItem;
+
+/**
+ * Function that fills a contiguous distance matrix with the edge costs.
+ * @param graph - pointer to the graph
+ * @param dist - pre-allocated V x V matrix
+ */
+void fillDistanceMatrix(Graph graph, int *dist) {
+    if (!graph || !dist) return;
+
+    size_t n = (size_t) graph->V;
+    for (size_t i = 0; i < n * n; i++) {
+        dist[i] = INFINITY;
+    }
+
+    // One pass over the adjacency lists instead of V^2 calls to getCost
+    for (size_t u = 0; u < n; u++) {
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+            int *cell = &dist[u * n + tmp->data.v];
+            if (tmp->data.cost < *cell) *cell = tmp->data.cost;
+        }
+    }
+}
+
+/**
+ * Function that relaxes the tile [i0, i1) x [j0, j1) through the vertices [k0, k1).
+ * @param dist - contiguous V x V matrix
+ * @param n - number of vertices (row stride)
+ */
+static void relaxTile(int *dist, size_t n, int i0, int i1, int j0, int j1, int k0, int k1) {
+    for (int k = k0; k < k1; k++) {
+        const int *rowK = dist + (size_t) k * n;
+
+        for (int i = i0; i < i1; i++) {
+            int *rowI = dist + (size_t) i * n;
+            int dik = rowI[k];
+            if (dik == INFINITY) continue;
+
+            // Min-plus over the row; the select keeps INFINITY + cost from
+            // turning into a finite value when costs are negative
+            #pragma omp simd
+            for (int j = j0; j < j1; j++) {
+                int cand = rowK[j] == INFINITY ? INFINITY : dik + rowK[j];
+                rowI[j] = cand < rowI[j] ? cand : rowI[j];
+            }
+        }
+    }
+}
+
+/**
+ * Function that runs the classic Floyd-Warshall triple loop.
+ * @param dist - contiguous V x V matrix
+ * @param V - number of vertices
+ */
+void floydWarshallNaive(int *dist, int V) {
+    if (!dist || V <= 0) return;
+
+    relaxTile(dist, (size_t) V, 0, V, 0, V, 0, V);
+}
+
+/**
+ * Function that runs the 3-phase blocked Floyd-Warshall.
+ * @param dist - contiguous V x V matrix
+ * @param V - number of vertices
+ * @param block - tile size
+ */
+void floydWarshallBlocked(int *dist, int V, int block) {
+    if (!dist || V <= 0) return;
+    if (block <= 0) block = APSP_BLOCK;
+
+    size_t n = (size_t) V;
+    int nb = (V + block - 1) / block;
+
+    // One team for the whole run; the implicit barriers after `single` and
+    // `for` separate the phases
+    #pragma omp parallel
+    for (int kb = 0; kb < nb; kb++) {
+        int k0 = kb * block;
+        int k1 = k0 + block < V ? k0 + block : V;
+
+        // Phase 1: the diagonal tile depends only on itself
+        #pragma omp single
+        relaxTile(dist, n, k0, k1, k0, k1, k0, k1);
+
+        // Phase 2: tiles on row k and column k depend on the diagonal tile
+        #pragma omp for schedule(static)
+        for (int b = 0; b < nb; b++) {
+            if (b == kb) continue;
+            int b0 = b * block;
+            int b1 = b0 + block < V ? b0 + block : V;
+
+            relaxTile(dist, n, k0, k1, b0, b1, k0, k1);
+            relaxTile(dist, n, b0, b1, k0, k1, k0, k1);
+        }
+
+        // Phase 3: every other tile depends on its row and column tiles
+        #pragma omp for schedule(static)
+        for (int t = 0; t < nb * nb; t++) {
+            int ib = t / nb, jb = t % nb;
+            if (ib == kb || jb == kb) continue;
+            int i0 = ib * block, j0 = jb * block;
+            int i1 = i0 + block < V ? i0 + block : V;
+            int j1 = j0 + block < V ? j0 + block : V;
+
+            relaxTile(dist, n, i0, i1, j0, j1, k0, k1);
+        }
+    }
+}
+
+/**
+ * Function that pushes an entry onto the lazy binary heap.
+ */
+static void heapPush(HeapItem *heap, long *size, int key, int v) {
+    long i = (*size)++;
+    while (i > 0) {
+        long parent = (i - 1) / 2;
+        if (heap[parent].key <= key) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i].key = key;
+    heap[i].v = v;
+}
+
+/**
+ * Function that removes the entry with the smallest key from the lazy heap.
+ */
+static HeapItem heapPop(HeapItem *heap, long *size) {
+    HeapItem top = heap[0];
+    HeapItem last = heap[--(*size)];
+    long n = *size, i = 0;
+
+    while (2 * i + 1 < n) {
+        long child = 2 * i + 1;
+        if (child + 1 < n && heap[child + 1].key < heap[child].key) child++;
+        if (last.key <= heap[child].key) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (n > 0) heap[i] = last;
+
+    return top;
+}
+
+/**
+ * Function that computes the potentials of Johnson's reweighting.
+ * Bellman-Ford from a virtual source joined to every vertex by a 0-cost arc.
+ * @param csr - the graph
+ * @param h - array of V potentials
+ * @return - 0 on success, -1 if the graph has a negative cycle
+ */
+static int johnsonPotentials(const CsrGraph *csr, int *h) {
+    for (int v = 0; v < csr->nn; v++) {
+        h[v] = 0;
+    }
+
+    for (int pass = 0; pass <= csr->nn; pass++) {
+        int changed = 0;
+        for (int u = 0; u < csr->nn; u++) {
+            for (long k = csr->off[u]; k < csr->off[u + 1]; k++) {
+                if (h[u] + csr->cost[k] < h[csr->adj[k]]) {
+                    h[csr->adj[k]] = h[u] + csr->cost[k];
+                    changed = 1;
+                }
+            }
+        }
+        if (!changed) return 0;
+    }
+
+    // Still relaxing after V + 1 passes (V + 1 vertices with the virtual one)
+    return -1;
+}
+
+/**
+ * Function that fills one row of the distance matrix with Dijkstra.
+ * The search starts from the arcs of `s` rather than from `s` itself, so the
+ * diagonal holds the cheapest cycle through `s` like in Floyd-Warshall.
+ * @param csr - the graph
+ * @param rc - non-negative reduced cost of every arc
+ * @param h - Johnson potentials
+ * @param s - source vertex
+ * @param d - scratch array of V reduced distances
+ * @param heap - scratch heap with room for 2 * E entries
+ * @param row - output row of the distance matrix
+ */
+static void dijkstraRow(const CsrGraph *csr, const int *rc, const int *h, int s,
+                        int *d, HeapItem *heap, int *row) {
+    long size = 0;
+
+    for (int v = 0; v < csr->nn; v++) {
+        d[v] = INT_MAX;
+    }
+
+    for (long k = csr->off[s]; k < csr->off[s + 1]; k++) {
+        int v = csr->adj[k];
+        if (rc[k] < d[v]) {
+            d[v] = rc[k];
+            heapPush(heap, &size, d[v], v);
+        }
+    }
+
+    while (size > 0) {
+        HeapItem item = heapPop(heap, &size);
+        int u = item.v;
+        if (item.key > d[u]) continue; // stale entry
+
+        for (long k = csr->off[u]; k < csr->off[u + 1]; k++) {
+            int v = csr->adj[k];
+            if (item.key + rc[k] < d[v]) {
+                d[v] = item.key + rc[k];
+                heapPush(heap, &size, d[v], v);
+            }
+        }
+    }
+
+    // Undo the reweighting
+    for (int v = 0; v < csr->nn; v++) {
+        row[v] = d[v] == INT_MAX ? INFINITY : d[v] - h[s] + h[v];
+    }
+}
+
+/**
+ * Function that computes all pairs shortest paths with Johnson's algorithm.
+ * @param graph - pointer to the graph
+ * @param dist - pre-allocated V x V matrix
+ * @return - 0 on success, -1 on a negative cycle or allocation failure
+ */
+int johnsonAllPairs(Graph graph, int *dist) {
+    if (!graph || !dist) return -1;
+
+    CsrGraph *csr = graphToCsr(graph);
+    if (!csr) return -1;
+
+    int n = csr->nn;
+    size_t na = csr->na > 0 ? (size_t) csr->na : 1;
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+
+    int *h = malloc(n * sizeof(int));
+    int *rc = malloc(na * sizeof(int));
+    int *d = malloc((size_t) threads * n * sizeof(int));
+    HeapItem *heap = malloc((size_t) threads * 2 * na * sizeof(HeapItem));
+    if (!h || !rc || !d || !heap) {
+        fprintf(stderr, "Error: Memory allocation failed for Johnson buffers.\n");
+        free(h);
+        free(rc);
+        free(d);
+        free(heap);
+        freeCsr(csr);
+        return -1;
+    }
+
+    int ret = johnsonPotentials(csr, h);
+    if (ret == 0) {
+        for (int u = 0; u < n; u++) {
+            for (long k = csr->off[u]; k < csr->off[u + 1]; k++) {
+                rc[k] = csr->cost[k] + h[u] - h[csr->adj[k]];
+            }
+        }
+
+        // Sources are independent; dynamic chunks balance uneven reach
+        #pragma omp parallel
+        {
+            int tid = 0;
+#ifdef _OPENMP
+            tid = omp_get_thread_num();
+#endif
+            int *myD = d + (size_t) tid * n;
+            HeapItem *myHeap = heap + (size_t) tid * 2 * na;
+
+            #pragma omp for schedule(dynamic, 16)
+            for (int s = 0; s < n; s++) {
+                dijkstraRow(csr, rc, h, s, myD, myHeap, dist + (size_t) s * n);
+            }
+        }
+    }
+
+    free(h);
+    free(rc);
+    free(d);
+    free(heap);
+    freeCsr(csr);
+    return ret;
+}
+
+/**
+ * Function that picks the cheaper all-pairs algorithm from the graph size.
+ * @param V - number of vertices
+ * @param E - number of arcs
+ * @return - APSP_JOHNSON for sparse graphs, APSP_FLOYD_WARSHALL otherwise
+ */
+ApspMethod chooseApspMethod(int V, long E) {
+    // ceil(log2(V)) without <math.h>, whose INFINITY clashes with graph.h
+    int logV = 1;
+    while (logV < 31 && (1 << logV) < V) logV++;
+
+    double dijkstra = APSP_DIJKSTRA_WEIGHT * (double) E * logV;
+    return dijkstra < (double) V * V ? APSP_JOHNSON : APSP_FLOYD_WARSHALL;
+}
+
+/**
+ * Function that computes all pairs shortest paths with the chosen algorithm.
+ * @param graph - pointer to the graph
+ * @param dist - pre-allocated V x V matrix
+ * @param method - algorithm to use, APSP_AUTO to choose by density
+ * @return - the algorithm that produced the matrix
+ */
+ApspMethod allPairsShortestPaths(Graph graph, int *dist, ApspMethod method) {
+    if (!graph || !dist) return method;
+
+    if (method == APSP_AUTO) {
+        long arcs = 0;
+        for (int u = 0; u < graph->V; u++) {
+            for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) arcs++;
+        }
+        method = chooseApspMethod(graph->V, arcs);
+    }
+
+    if (method == APSP_JOHNSON && johnsonAllPairs(graph, dist) == 0) {
+        return APSP_JOHNSON;
+    }
+
+    fillDistanceMatrix(graph, dist);
+    floydWarshallBlocked(dist, graph->V, APSP_BLOCK);
+    return APSP_FLOYD_WARSHALL;
+}
+
+/**
+ * Function that updates an all-pairs matrix after an arc insertion or decrease.
+ * @param dist - contiguous V x V matrix of shortest paths
+ * @param V - number of vertices
+ * @param u - start vertex of the arc
+ * @param v - end vertex of the arc
+ * @param cost - new cost of the arc
+ * @return - number of changed entries, -1 on a new negative cycle, -2 on error
+ */
+long updateAllPairsArc(int *dist, int V, int u, int v, int cost) {
+    if (!dist || V <= 0 || u < 0 || v < 0 || u >= V || v >= V) return -2;
+
+    size_t n = (size_t) V;
+
+    // A new cycle u -> v ~> u must not be negative
+    int back = u == v ? 0 : dist[v * n + u];
+    if (back != INFINITY && cost + back < 0) return -1;
+
+    int *pre = malloc(n * sizeof(int));
+    int *post = malloc(n * sizeof(int));
+    int *rows = malloc(n * sizeof(int));
+    int *cols = malloc(n * sizeof(int));
+    if (!pre || !post || !rows || !cols) {
+        fprintf(stderr, "Error: Memory allocation failed for all-pairs update.\n");
+        free(pre);
+        free(post);
+        free(rows);
+        free(cols);
+        return -2;
+    }
+
+    // pre[i]: best walk i ~> u, post[j]: best walk v ~> j (empty walks cost 0).
+    // The diagonal holds cycles, so both are copied before any update.
+    int numRows = 0, numCols = 0;
+    for (size_t i = 0; i < n; i++) {
+        pre[i] = i == (size_t) u ? 0 : dist[i * n + u];
+        post[i] = i == (size_t) v ? 0 : dist[v * n + i];
+    }
+    for (int i = 0; i < V; i++) {
+        if (pre[i] != INFINITY && pre[i] + cost < dist[i * n + v]) rows[numRows++] = i;
+        if (post[i] != INFINITY && cost + post[i] < dist[u * n + i]) cols[numCols++] = i;
+    }
+
+    long changed = 0;
+    #pragma omp parallel for schedule(static) reduction(+:changed)
+    for (int r = 0; r < numRows; r++) {
+        int *row = dist + (size_t) rows[r] * n;
+        int through = pre[rows[r]] + cost;
+
+        for (int c = 0; c < numCols; c++) {
+            int j = cols[c];
+            if (through + post[j] < row[j]) {
+                row[j] = through + post[j];
+                changed++;
+            }
+        }
+    }
+
+    free(pre);
+    free(post);
+    free(rows);
+    free(cols);
+    return changed;
+}
@@ -0,0 +1,207 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "include/graph.h"
+#include "include/sssp.h"
+
+/*
+ * Benchmarks the Bellman-Ford variants on large sparse graphs with negative
+ * costs: a random graph (small diameter) and a grid (large diameter). Costs
+ * are a base in [0, 100) plus p[u] - p[v] for random potentials p, so there
+ * are negative arcs but no negative cycles. The original fixed V - 1 rounds
+ * would take hours here, so their time is estimated from one full round.
+ * "par" is the parallel Jacobi variant over a flat edge array. Finally a
+ * negative cycle is added and every variant must report it.
+ *
+ * Usage: bfbench [V=200000] [gridSide=400]
+ */
+
+#define OUT_DEGREE 5
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (unsigned) (rngState >> 32);
+}
+
+static double nowMs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static int *randomPotentials(int n) {
+    int *p = malloc(n * sizeof(int));
+    if (!p) return NULL;
+    for (int v = 0; v < n; v++) {
+        p[v] = rng() % 20;
+    }
+    return p;
+}
+
+static Graph randomGraph(int n) {
+    Graph graph = initGraph(n, 1);
+    int *p = randomPotentials(n);
+    if (!graph || !p) {
+        free(p);
+        freeGraph(graph);
+        return NULL;
+    }
+
+    for (int u = 0; u < n; u++) {
+        for (int e = 0; e < OUT_DEGREE; e++) {
+            int v = rng() % n;
+            graph = insertEdge(graph, u, v, (int) (rng() % 100) + p[u] - p[v]);
+        }
+    }
+
+    free(p);
+    return graph;
+}
+
+static Graph gridGraph(int side) {
+    int n = side * side;
+    Graph graph = initGraph(n, 1);
+    int *p = randomPotentials(n);
+    if (!graph || !p) {
+        free(p);
+        freeGraph(graph);
+        return NULL;
+    }
+
+    for (int r = 0; r < side; r++) {
+        for (int c = 0; c < side; c++) {
+            int u = r * side + c;
+            if (c + 1 < side) {
+                graph = insertEdge(graph, u, u + 1, (int) (rng() % 100) + p[u] - p[u + 1]);
+                graph = insertEdge(graph, u + 1, u, (int) (rng() % 100) + p[u + 1] - p[u]);
+            }
+            if (r + 1 < side) {
+                graph = insertEdge(graph, u, u + side, (int) (rng() % 100) + p[u] - p[u + side]);
+                graph = insertEdge(graph, u + side, u, (int) (rng() % 100) + p[u + side] - p[u]);
+            }
+        }
+    }
+
+    free(p);
+    return graph;
+}
+
+/**
+ * Function that times one full relaxation round over every arc.
+ */
+static double oneRoundMs(Graph graph, int *distances) {
+    double t0 = nowMs();
+    for (int u = 0; u < graph->V; u++) {
+        if (distances[u] == INFINITY) continue;
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+            if (distances[u] + tmp->data.cost < distances[tmp->data.v]) {
+                distances[tmp->data.v] = distances[u] + tmp->data.cost;
+            }
+        }
+    }
+    return nowMs() - t0;
+}
+
+static int runGraph(const char *name, Graph graph) {
+    int n = graph->V;
+    long arcs = 0;
+    for (int u = 0; u < n; u++) {
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) arcs++;
+    }
+
+    int *ref = malloc(n * sizeof(int));
+    int *dist = malloc(n * sizeof(int));
+    if (!ref || !dist) {
+        fprintf(stderr, "Error: Memory allocation failed for benchmark buffers.\n");
+        free(ref);
+        free(dist);
+        return 0;
+    }
+
+    double t0 = nowMs();
+    SsspStatus rounds = bellmanFordRounds(graph, 0, ref);
+    double roundsMs = nowMs() - t0;
+
+    t0 = nowMs();
+    SsspStatus queue = bellmanFordQueue(graph, 0, dist);
+    double queueMs = nowMs() - t0;
+
+    int ok = rounds == SSSP_OK && queue == SSSP_OK &&
+             memcmp(ref, dist, n * sizeof(int)) == 0;
+
+    t0 = nowMs();
+    SsspStatus parallel = bellmanFordParallel(graph, 0, dist);
+    double parallelMs = nowMs() - t0;
+    ok &= parallel == SSSP_OK && memcmp(ref, dist, n * sizeof(int)) == 0;
+
+    double fixedMs = oneRoundMs(graph, dist) * (n - 1);
+    printf("%-8s %8d %9ld %14.0f %10.1f %10.1f %10.1f %6s\n", name, n, arcs,
+           fixedMs, roundsMs, queueMs, parallelMs, ok ? "yes" : "NO");
+
+    // Close a negative cycle 0 -> v -> 0 through a vertex reachable from 0
+    int v = graph->adjLists[0] ? graph->adjLists[0]->data.v : 1;
+    graph = insertEdge(graph, 0, v, -1);
+    graph = insertEdge(graph, v, 0, ref[v] > 0 ? -ref[v] : -1);
+
+    t0 = nowMs();
+    rounds = bellmanFordRounds(graph, 0, ref);
+    roundsMs = nowMs() - t0;
+    t0 = nowMs();
+    queue = bellmanFordQueue(graph, 0, dist);
+    queueMs = nowMs() - t0;
+    t0 = nowMs();
+    parallel = bellmanFordParallel(graph, 0, dist);
+    parallelMs = nowMs() - t0;
+
+    int found = rounds == SSSP_NEGATIVE_CYCLE && queue == SSSP_NEGATIVE_CYCLE &&
+                parallel == SSSP_NEGATIVE_CYCLE;
+    printf("%-8s %8s %9s %14s %10.1f %10.1f %10.1f %6s\n", "+cycle", "", "", "",
+           roundsMs, queueMs, parallelMs, found ? "found" : "MISSED");
+
+    free(ref);
+    free(dist);
+    return ok && found;
+}
+
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 200000;
+    int side = argc > 2 ? atoi(argv[2]) : 400;
+    if (n <= 1 || side <= 1) {
+        fprintf(stderr, "Usage: %s [V] [gridSide]\n", argv[0]);
+        return 1;
+    }
+
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    printf("%d thread(s)\n", threads);
+    printf("%-8s %8s %9s %14s %10s %10s %10s %6s\n", "graph", "V", "E",
+           "fixed ms (est)", "rounds ms", "spfa ms", "par ms", "match");
+
+    int ok = 1;
+    Graph graph = randomGraph(n);
+    if (!graph) return 1;
+    ok &= runGraph("random", graph);
+    freeGraph(graph);
+
+    graph = gridGraph(side);
+    if (!graph) return 1;
+    ok &= runGraph("grid", graph);
+    freeGraph(graph);
+
+    printf(ok ? "distances match\n" : "distances DIFFER\n");
+    return ok ? 0 : 1;
+}
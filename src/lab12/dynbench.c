@@ -0,0 +1,134 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "include/graph.h"
+#include "include/apsp.h"
+#include "include/sssp.h"
+
+/*
+ * Validates the incremental shortest-path updates against full recomputation.
+ * A random digraph with negative arcs (costs base + p[u] - p[v], no negative
+ * cycles) gets a series of cheap arc insertions; after every insertion the
+ * single-source distances are compared with a fresh SPFA run, and every
+ * CHECK_EVERY insertions the all-pairs matrix with a fresh computation.
+ * Finally an arc closing a negative cycle must be rejected by both updates.
+ *
+ * Usage: dynbench [V=1500] [insertions=300]
+ */
+
+#define OUT_DEGREE 4
+#define CHECK_EVERY 25
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (unsigned) (rngState >> 32);
+}
+
+static double nowMs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1500;
+    int inserts = argc > 2 ? atoi(argv[2]) : 300;
+    if (n <= 1 || inserts <= 0) {
+        fprintf(stderr, "Usage: %s [V] [insertions]\n", argv[0]);
+        return 1;
+    }
+
+    size_t cells = (size_t) n * n;
+    Graph graph = initGraph(n, 1);
+    int *p = malloc(n * sizeof(int));
+    int *dist = malloc(cells * sizeof(int));
+    int *ref = malloc(cells * sizeof(int));
+    int *sd = malloc(n * sizeof(int));
+    int *sref = malloc(n * sizeof(int));
+    if (!graph || !p || !dist || !ref || !sd || !sref) {
+        fprintf(stderr, "Error: Memory allocation failed for benchmark buffers.\n");
+        return 1;
+    }
+
+    for (int v = 0; v < n; v++) {
+        p[v] = rng() % 20;
+    }
+    for (int u = 0; u < n; u++) {
+        for (int e = 0; e < OUT_DEGREE; e++) {
+            int v = rng() % n;
+            graph = insertEdge(graph, u, v, (int) (rng() % 100) + p[u] - p[v]);
+        }
+    }
+
+    allPairsShortestPaths(graph, dist, APSP_AUTO);
+    bellmanFordQueue(graph, 0, sd);
+
+    double apspUpdateMs = 0, ssspUpdateMs = 0, apspFullMs = 0, ssspFullMs = 0;
+    long changed = 0;
+    int apspChecks = 0, ok = 1;
+
+    for (int k = 0; k < inserts && ok; k++) {
+        // Cheaper than the typical arc, so most insertions shorten something
+        int u = rng() % n, v = rng() % n;
+        int cost = (int) (rng() % 20) + p[u] - p[v];
+        graph = insertEdge(graph, u, v, cost);
+
+        double t0 = nowMs();
+        long c = updateAllPairsArc(dist, n, u, v, cost);
+        apspUpdateMs += nowMs() - t0;
+        changed += c;
+
+        t0 = nowMs();
+        SsspStatus status = updateSingleSourceArc(graph, 0, sd, u, v, cost);
+        ssspUpdateMs += nowMs() - t0;
+
+        t0 = nowMs();
+        bellmanFordQueue(graph, 0, sref);
+        ssspFullMs += nowMs() - t0;
+        ok &= c >= 0 && status == SSSP_OK && memcmp(sd, sref, n * sizeof(int)) == 0;
+
+        if ((k + 1) % CHECK_EVERY == 0) {
+            t0 = nowMs();
+            allPairsShortestPaths(graph, ref, APSP_AUTO);
+            apspFullMs += nowMs() - t0;
+            apspChecks++;
+            ok &= memcmp(dist, ref, cells * sizeof(int)) == 0;
+        }
+    }
+
+    printf("V=%d, %d insertions, %ld all-pairs entries changed\n", n, inserts, changed);
+    printf("%-10s %14s %14s\n", "", "update ms", "recompute ms");
+    printf("%-10s %14.3f %14.3f\n", "all-pairs", apspUpdateMs / inserts,
+           apspChecks ? apspFullMs / apspChecks : 0.0);
+    printf("%-10s %14.3f %14.3f\n", "sssp", ssspUpdateMs / inserts, ssspFullMs / inserts);
+
+    // Close a negative cycle through two vertices joined by a finite path
+    int a = 0, b = 1;
+    while (b < n && dist[(size_t) a * n + b] == INFINITY) b++;
+    if (b < n) {
+        int cost = -dist[(size_t) a * n + b] - 1;
+        graph = insertEdge(graph, b, a, cost);
+        int apspCycle = updateAllPairsArc(dist, n, b, a, cost) == -1;
+        int ssspCycle = updateSingleSourceArc(graph, 0, sd, b, a, cost) == SSSP_NEGATIVE_CYCLE;
+        printf("negative cycle %s\n", apspCycle && ssspCycle ? "detected" : "MISSED");
+        ok &= apspCycle && ssspCycle;
+    }
+
+    printf(ok ? "distances match\n" : "distances DIFFER\n");
+
+    free(p);
+    free(dist);
+    free(ref);
+    free(sd);
+    free(sref);
+    freeGraph(graph);
+    return ok ? 0 : 1;
+}
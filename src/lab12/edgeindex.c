@@ -0,0 +1,267 @@
+#include <string.h>
+
+#include "include/edgeindex.h"
+
+#define EMPTY_KEY (~0ULL)
+
+static inline unsigned long long edgeKey(int u, int v) {
+    return (unsigned long long) (unsigned) u << 32 | (unsigned) v;
+}
+
+/* Fibonacci hashing: the top bits of key * 2^64 / phi */
+static inline size_t hashSlot(unsigned long long key, int shift) {
+    return (size_t) ((key * 0x9E3779B97F4A7C15ULL) >> shift);
+}
+
+static int compareKeys(const void *a, const void *b) {
+    unsigned long long x = *(const unsigned long long *) a;
+    unsigned long long y = *(const unsigned long long *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Function that picks the index kind from the graph size.
+ * @param V - number of vertices
+ * @param E - number of arcs
+ * @return - the chosen index kind
+ */
+EdgeIndexType chooseEdgeIndex(int V, long E) {
+    double density = (double) E / ((double) V * V);
+
+    if (V <= EDGE_INDEX_SMALL_V || (V <= EDGE_INDEX_MATRIX_MAX_V && density >= EDGE_INDEX_DENSE))
+        return EDGE_INDEX_MATRIX;
+    if (E >= (long) EDGE_INDEX_HASH_DEGREE * V)
+        return EDGE_INDEX_HASH;
+    return EDGE_INDEX_SORTED;
+}
+
+/**
+ * Function that fills the presence bits and cost matrix.
+ * @return - 0 on success, -1 on allocation failure
+ */
+static int buildMatrix(EdgeIndex *index, Graph graph) {
+    size_t n = (size_t) graph->V;
+    index->bits = calloc((n * n + 63) / 64, sizeof(unsigned long long));
+    index->matrix = malloc(n * n * sizeof(int));
+    if (!index->bits || !index->matrix) return -1;
+
+    for (size_t u = 0; u < n; u++) {
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+            size_t cell = u * n + tmp->data.v;
+            if (index->bits[cell / 64] >> (cell % 64) & 1) continue; // keep the first arc
+
+            index->bits[cell / 64] |= 1ULL << (cell % 64);
+            index->matrix[cell] = tmp->data.cost;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Function that builds per-vertex neighbour arrays sorted by id.
+ * Parallel arcs are collapsed to the first one of the list.
+ * @return - 0 on success, -1 on allocation failure
+ */
+static int buildSorted(EdgeIndex *index, Graph graph, long arcs) {
+    int n = graph->V;
+    long maxDeg = 0;
+
+    index->off = calloc((size_t) n + 1, sizeof(long));
+    index->adj = malloc((arcs > 0 ? arcs : 1) * sizeof(int));
+    index->cost = malloc((arcs > 0 ? arcs : 1) * sizeof(int));
+    if (!index->off || !index->adj || !index->cost) return -1;
+
+    for (int u = 0; u < n; u++) {
+        long deg = 0;
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) deg++;
+        if (deg > maxDeg) maxDeg = deg;
+    }
+
+    // Sort (neighbour, list position) keys so equal neighbours keep list order
+    unsigned long long *keys = malloc((maxDeg > 0 ? maxDeg : 1) * sizeof(unsigned long long));
+    int *costs = malloc((maxDeg > 0 ? maxDeg : 1) * sizeof(int));
+    if (!keys || !costs) {
+        free(keys);
+        free(costs);
+        return -1;
+    }
+
+    long k = 0;
+    for (int u = 0; u < n; u++) {
+        int deg = 0;
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next, deg++) {
+            keys[deg] = edgeKey(tmp->data.v, deg);
+            costs[deg] = tmp->data.cost;
+        }
+        qsort(keys, deg, sizeof(unsigned long long), compareKeys);
+
+        for (int i = 0; i < deg; i++) {
+            int v = (int) (keys[i] >> 32);
+            if (i > 0 && v == (int) (keys[i - 1] >> 32)) continue;
+            index->adj[k] = v;
+            index->cost[k] = costs[keys[i] & 0xFFFFFFFFULL];
+            k++;
+        }
+        index->off[u + 1] = k;
+    }
+
+    free(keys);
+    free(costs);
+    return 0;
+}
+
+/**
+ * Function that builds the open-addressing hash over all arcs.
+ * @return - 0 on success, -1 on allocation failure
+ */
+static int buildHash(EdgeIndex *index, Graph graph, long arcs) {
+    // Power of two capacity, at most half full
+    int bits = 4;
+    while ((1L << bits) < 2 * arcs) bits++;
+    size_t capacity = (size_t) 1 << bits;
+
+    index->shift = 64 - bits;
+    index->keys = malloc(capacity * sizeof(unsigned long long));
+    index->values = malloc(capacity * sizeof(int));
+    if (!index->keys || !index->values) return -1;
+    memset(index->keys, 0xFF, capacity * sizeof(unsigned long long));
+
+    for (int u = 0; u < graph->V; u++) {
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+            unsigned long long key = edgeKey(u, tmp->data.v);
+            size_t slot = hashSlot(key, index->shift);
+
+            // Linear probing; an existing key means a parallel arc, keep the first
+            while (index->keys[slot] != EMPTY_KEY && index->keys[slot] != key) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            if (index->keys[slot] == EMPTY_KEY) {
+                index->keys[slot] = key;
+                index->values[slot] = tmp->data.cost;
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * Function that builds an edge lookup index over the graph.
+ * @param graph - pointer to the graph
+ * @param type - kind of index, EDGE_INDEX_AUTO to choose by density
+ * @return - pointer to the index, or NULL on error
+ */
+EdgeIndex *buildEdgeIndex(Graph graph, EdgeIndexType type) {
+    if (!graph) return NULL;
+
+    long arcs = 0;
+    for (int u = 0; u < graph->V; u++) {
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) arcs++;
+    }
+    if (type == EDGE_INDEX_AUTO) type = chooseEdgeIndex(graph->V, arcs);
+
+    EdgeIndex *index = calloc(1, sizeof(EdgeIndex));
+    if (!index) {
+        fprintf(stderr, "Error: Memory allocation failed for edge index.\n");
+        return NULL;
+    }
+    index->type = type;
+    index->V = graph->V;
+
+    int ret;
+    switch (type) {
+        case EDGE_INDEX_MATRIX:
+            ret = buildMatrix(index, graph);
+            break;
+        case EDGE_INDEX_HASH:
+            ret = buildHash(index, graph, arcs);
+            break;
+        default:
+            ret = buildSorted(index, graph, arcs);
+            break;
+    }
+
+    if (ret != 0) {
+        fprintf(stderr, "Error: Memory allocation failed for edge index.\n");
+        freeEdgeIndex(index);
+        return NULL;
+    }
+    return index;
+}
+
+/**
+ * Function that looks up an arc in the index.
+ * @param index - pointer to the index
+ * @param u - start vertex
+ * @param v - end vertex
+ * @param cost - output: cost of the arc, if found
+ * @return - 1 if the arc exists, 0 otherwise
+ */
+int findEdgeIndex(const EdgeIndex *index, int u, int v, int *cost) {
+    if (!index || u < 0 || v < 0 || u >= index->V || v >= index->V) return 0;
+
+    switch (index->type) {
+        case EDGE_INDEX_MATRIX: {
+            size_t cell = (size_t) u * index->V + v;
+            if (!(index->bits[cell / 64] >> (cell % 64) & 1)) return 0;
+            if (cost) *cost = index->matrix[cell];
+            return 1;
+        }
+
+        case EDGE_INDEX_HASH: {
+            unsigned long long key = edgeKey(u, v);
+            size_t mask = ((size_t) 1 << (64 - index->shift)) - 1;
+            for (size_t slot = hashSlot(key, index->shift);
+                 index->keys[slot] != EMPTY_KEY; slot = (slot + 1) & mask) {
+                if (index->keys[slot] == key) {
+                    if (cost) *cost = index->values[slot];
+                    return 1;
+                }
+            }
+            return 0;
+        }
+
+        default: {
+            // Lower bound of v among the sorted neighbours of u
+            long lo = index->off[u], hi = index->off[u + 1];
+            while (lo < hi) {
+                long mid = lo + (hi - lo) / 2;
+                if (index->adj[mid] < v) lo = mid + 1;
+                else hi = mid;
+            }
+            if (lo == index->off[u + 1] || index->adj[lo] != v) return 0;
+            if (cost) *cost = index->cost[lo];
+            return 1;
+        }
+    }
+}
+
+/**
+ * Function that frees an edge lookup index.
+ * @param index - pointer to the index
+ */
+void freeEdgeIndex(EdgeIndex *index) {
+    if (!index) return;
+
+    free(index->bits);
+    free(index->matrix);
+    free(index->off);
+    free(index->adj);
+    free(index->cost);
+    free(index->keys);
+    free(index->values);
+    free(index);
+}
+
+/**
+ * Function that attaches a fresh edge index to the graph.
+ * @param graph - pointer to the graph
+ * @param type - kind of index, EDGE_INDEX_AUTO to choose by density
+ * @return - 0 on success, -1 on error
+ */
+int indexGraph(Graph graph, EdgeIndexType type) {
+    if (!graph) return -1;
+
+    freeEdgeIndex(graph->index);
+    graph->index = buildEdgeIndex(graph, type);
+    return graph->index ? 0 : -1;
+}
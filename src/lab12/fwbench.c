@@ -0,0 +1,144 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "include/graph.h"
+#include "include/apsp.h"
+
+/*
+ * Benchmarks the all-pairs engines on random directed graphs with costs in
+ * [-9, 109) and no negative cycles: the classic triple loop, the blocked
+ * Floyd-Warshall and Johnson (V Dijkstras). Every V is run with a sparse and
+ * a dense out-degree, and the "auto" column shows what allPairsShortestPaths
+ * picks. The naive version is only timed up to NAIVE_LIMIT vertices, above
+ * that it takes minutes.
+ *
+ * Usage: fwbench [V ...]   (default: 2000 4000)
+ */
+
+#define NAIVE_LIMIT 2000
+#define SPARSE_DEGREE 8
+#define DENSE_FRACTION 10
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (unsigned) (rngState >> 32);
+}
+
+static double nowMs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+/**
+ * Function that builds a random directed graph without negative cycles:
+ * every cost is a non-negative base plus p[u] - p[v] for random potentials p,
+ * so the costs around any cycle add up to the (non-negative) bases.
+ */
+static Graph randomGraph(int n, int degree) {
+    Graph graph = initGraph(n, 1);
+    int *p = malloc(n * sizeof(int));
+    if (!graph || !p) {
+        free(p);
+        freeGraph(graph);
+        return NULL;
+    }
+
+    for (int v = 0; v < n; v++) {
+        p[v] = rng() % 10;
+    }
+
+    for (int u = 0; u < n; u++) {
+        for (int e = 0; e < degree; e++) {
+            int v = rng() % n;
+            graph = insertEdge(graph, u, v, (int) (rng() % 100) + p[u] - p[v]);
+        }
+    }
+
+    free(p);
+    return graph;
+}
+
+static int runSize(int n, int degree) {
+    Graph graph = randomGraph(n, degree);
+    size_t cells = (size_t) n * n;
+    int *dist = malloc(cells * sizeof(int));
+    int *ref = malloc(cells * sizeof(int));
+    if (!graph || !dist || !ref) {
+        fprintf(stderr, "Error: Memory allocation failed for benchmark buffers.\n");
+        free(dist);
+        free(ref);
+        freeGraph(graph);
+        return 0;
+    }
+
+    int ok = 1;
+    printf("%6d %9ld ", n, (long) n * degree);
+
+    if (n <= NAIVE_LIMIT) {
+        fillDistanceMatrix(graph, dist);
+        double t0 = nowMs();
+        floydWarshallNaive(dist, n);
+        printf("%10.1f ", nowMs() - t0);
+    } else {
+        printf("%10s ", "-");
+    }
+
+    fillDistanceMatrix(graph, ref);
+    double t0 = nowMs();
+    floydWarshallBlocked(ref, n, APSP_BLOCK);
+    printf("%10.1f ", nowMs() - t0);
+    if (n <= NAIVE_LIMIT) ok &= memcmp(ref, dist, cells * sizeof(int)) == 0;
+
+    t0 = nowMs();
+    int ret = johnsonAllPairs(graph, dist);
+    printf("%10.1f ", nowMs() - t0);
+    ok &= ret == 0 && memcmp(ref, dist, cells * sizeof(int)) == 0;
+
+    ApspMethod pick = chooseApspMethod(n, (long) n * degree);
+    printf("%8s %6s\n", pick == APSP_JOHNSON ? "johnson" : "fw", ok ? "yes" : "NO");
+
+    free(dist);
+    free(ref);
+    freeGraph(graph);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    int defaults[] = {2000, 4000};
+    int count = argc > 1 ? argc - 1 : 2;
+
+    int threads = 1;
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+#endif
+    printf("%d thread(s)\n", threads);
+    printf("%6s %9s %10s %10s %10s %8s %6s\n", "V", "E", "naive ms", "fw ms",
+           "johnson ms", "auto", "match");
+
+    int ok = 1;
+    for (int i = 0; i < count; i++) {
+        int n = argc > 1 ? atoi(argv[i + 1]) : defaults[i];
+        if (n <= 0) {
+            fprintf(stderr, "Usage: %s [V ...]\n", argv[0]);
+            return 1;
+        }
+        ok &= runSize(n, SPARSE_DEGREE);
+        ok &= runSize(n, n / DENSE_FRACTION);
+    }
+
+    printf(ok ? "distances match\n" : "distances DIFFER\n");
+    return ok ? 0 : 1;
+}
@@ -1,6 +1,11 @@
 #include <string.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "include/graph.h"
+#include "include/edgeindex.h"
 
 /**
  * Function that initializes a graph with a specific number of nodes.
@@ -23,6 +28,9 @@ Graph initGraph(int V, int type) {
 
     graph->V = V;
     graph->type = type;
+    graph->index = NULL;
+    graph->slabs = NULL;
+    graph->numSlabs = 0;
 
     // Initialize adjacency lists and auxiliary vectors
     graph->adjLists = (List*) calloc(V, sizeof(List));
@@ -54,6 +62,10 @@ Graph insertEdge(Graph graph, int u, int v, int cost) {
         return graph;
     }
 
+    // The index no longer matches the arcs
+    freeEdgeIndex(graph->index);
+    graph->index = NULL;
+
     // Add edge u -> v
     Pair p = {v, cost};
     graph->adjLists[u] = addLast(graph->adjLists[u], p);
@@ -67,6 +79,198 @@ Graph insertEdge(Graph graph, int u, int v, int cost) {
     return graph;
 }
 
+/**
+ * Function that checks if both endpoints of an edge are valid nodes.
+ * @param e - pointer to the edge
+ * @param n - number of nodes
+ * @return - 1 if the edge is valid, 0 otherwise
+ */
+static inline int validEdge(const Edge *e, int n) {
+    return e->u >= 0 && e->v >= 0 && e->u < n && e->v < n;
+}
+
+/**
+ * Function that counting-sorts the arcs of a batch by source into one
+ * contiguous block of list nodes, keeping the batch order per source.
+ * The batch is split in one chunk per thread: each chunk counts its arcs per
+ * source, a prefix sum over (source, chunk) gives every chunk its own slots.
+ * @param graph - pointer to the graph
+ * @param edges - array of edges
+ * @param count - number of edges
+ * @param off - output: start of the nodes of every source in the block (V + 1)
+ * @return - the block of nodes (NULL on error or if no arc is valid)
+ */
+static List sortArcs(Graph graph, const Edge *edges, long count, long *off) {
+    int n = graph->V, undirected = graph->type == 0;
+    int threads = 1;
+#ifdef _OPENMP
+    if (count >= BATCH_PARALLEL_MIN) threads = omp_get_max_threads();
+#endif
+
+    // hist[t * V + u]: arcs leaving u in chunk t, then the next free slot
+    long *hist = (long *) calloc((size_t) threads * n, sizeof(long));
+    if (!hist) {
+        fprintf(stderr, "Error: Memory allocation failed for edge counts.\n");
+        return NULL;
+    }
+
+    List slab = NULL;
+    #pragma omp parallel num_threads(threads)
+    {
+        // The team may be smaller than requested: split by its actual size
+        int t = 0, nt = 1;
+#ifdef _OPENMP
+        t = omp_get_thread_num();
+        nt = omp_get_num_threads();
+#endif
+        long lo = count * t / nt, hi = count * (t + 1) / nt;
+        long *h = hist + (size_t) t * n;
+
+        for (long i = lo; i < hi; i++) {
+            if (!validEdge(&edges[i], n)) continue;
+            h[edges[i].u]++;
+            if (undirected) h[edges[i].v]++;
+        }
+
+        #pragma omp barrier
+        #pragma omp single
+        {
+            long run = 0;
+            for (int u = 0; u < n; u++) {
+                off[u] = run;
+                for (int c = 0; c < nt; c++) {
+                    long cnt = hist[(size_t) c * n + u];
+                    hist[(size_t) c * n + u] = run;
+                    run += cnt;
+                }
+            }
+            off[n] = run;
+
+            if (run > 0) {
+                slab = (List) malloc((size_t) run * sizeof(struct list));
+                if (!slab) fprintf(stderr, "Error: Memory allocation failed for edge batch.\n");
+            }
+        }
+
+        // Same order as insertEdge: u -> v, then v -> u
+        if (slab) {
+            for (long i = lo; i < hi; i++) {
+                if (!validEdge(&edges[i], n)) continue;
+                List node = &slab[h[edges[i].u]++];
+                node->data.v = edges[i].v;
+                node->data.cost = edges[i].cost;
+                node->pooled = true;
+                if (undirected) {
+                    node = &slab[h[edges[i].v]++];
+                    node->data.v = edges[i].u;
+                    node->data.cost = edges[i].cost;
+                    node->pooled = true;
+                }
+            }
+        }
+    }
+
+    free(hist);
+    return slab;
+}
+
+/**
+ * Function that adds a batch of edges with one allocation for all new nodes.
+ * @param graph - pointer to the graph
+ * @param edges - array of edges
+ * @param count - number of edges
+ * @return - the modified graph
+ */
+Graph insertEdges(Graph graph, const Edge *edges, long count) {
+    if (!graph || count <= 0) return graph;
+    if (!edges) {
+        fprintf(stderr, "Error: Invalid edge batch.\n");
+        return graph;
+    }
+
+    int n = graph->V;
+    for (long i = 0; i < count; i++) {
+        if (!validEdge(&edges[i], n)) {
+            fprintf(stderr, "Error: Invalid edge (%d, %d).\n", edges[i].u, edges[i].v);
+        }
+    }
+
+    List *slabs = (List *) realloc(graph->slabs, (graph->numSlabs + 1) * sizeof(List));
+    if (slabs) graph->slabs = slabs;
+    long *off = (long *) malloc(((size_t) n + 1) * sizeof(long));
+    if (!slabs || !off) {
+        fprintf(stderr, "Error: Memory allocation failed for edge batch.\n");
+        free(off);
+        return graph;
+    }
+
+    List slab = sortArcs(graph, edges, count, off);
+    if (!slab) {
+        free(off);
+        return graph;
+    }
+
+    // The index no longer matches the arcs
+    freeEdgeIndex(graph->index);
+    graph->index = NULL;
+
+    // Link the nodes of every source and append them to its list
+    #pragma omp parallel for schedule(dynamic, 1024) if (count >= BATCH_PARALLEL_MIN)
+    for (int u = 0; u < n; u++) {
+        long first = off[u], last = off[u + 1] - 1;
+        if (first > last) continue;
+
+        for (long k = first; k <= last; k++) {
+            slab[k].prev = k > first ? &slab[k - 1] : NULL;
+            slab[k].next = k < last ? &slab[k + 1] : NULL;
+        }
+
+        List tail = graph->adjLists[u];
+        if (!tail) {
+            graph->adjLists[u] = &slab[first];
+            continue;
+        }
+        while (tail->next) tail = tail->next;
+        tail->next = &slab[first];
+        slab[first].prev = tail;
+    }
+
+    graph->slabs[graph->numSlabs] = slab;
+    graph->numSlabs++;
+
+    free(off);
+    return graph;
+}
+
+/**
+ * Function that builds a graph from a shared edge list.
+ * @param el - edge list
+ * @return - a pointer to the graph, or NULL on error
+ */
+Graph graphFromEdgeList(const EdgeList *el) {
+    if (!el) return NULL;
+
+    Graph graph = initGraph(el->nn, el->directed ? 1 : 0);
+    if (!graph) return NULL;
+
+    Edge *edges = (Edge *) malloc((el->ne > 0 ? el->ne : 1) * sizeof(Edge));
+    if (!edges) {
+        fprintf(stderr, "Error: Memory allocation failed for edge batch.\n");
+        freeGraph(graph);
+        return NULL;
+    }
+
+    for (long i = 0; i < el->ne; i++) {
+        edges[i].u = el->src[i];
+        edges[i].v = el->dst[i];
+        edges[i].cost = el->weighted ? el->cost[i] : 0;
+    }
+    insertEdges(graph, edges, el->ne);
+
+    free(edges);
+    return graph;
+}
+
 /**
  * Function that checks if there is an edge between two nodes.
  * @param graph - pointer to the graph
@@ -76,6 +280,7 @@ Graph insertEdge(Graph graph, int u, int v, int cost) {
  */
 int isArc(Graph graph, int u, int v) {
     if (!graph || u < 0 || v < 0 || u >= graph->V || v >= graph->V) return 0;
+    if (graph->index) return findEdgeIndex(graph->index, u, v, NULL);
 
     List tmp = graph->adjLists[u];
     while (tmp) {
@@ -94,6 +299,10 @@ int isArc(Graph graph, int u, int v) {
  */
 int getCost(Graph graph, int u, int v) {
     if (!graph || u < 0 || v < 0 || u >= graph->V || v >= graph->V) return INFINITY;
+    if (graph->index) {
+        int cost;
+        return findEdgeIndex(graph->index, u, v, &cost) ? cost : INFINITY;
+    }
 
     List tmp = graph->adjLists[u];
     while (tmp) {
@@ -189,6 +398,90 @@ void printGraph(Graph graph) {
     }
 }
 
+/**
+ * Function that builds a CSR copy of the graph.
+ * @param graph - pointer to the graph
+ * @return - a pointer to the CSR graph, or NULL on error
+ */
+CsrGraph *graphToCsr(Graph graph) {
+    if (!graph) return NULL;
+
+    CsrGraph *csr = (CsrGraph *) calloc(1, sizeof(CsrGraph));
+    if (!csr) {
+        fprintf(stderr, "Error: Memory allocation failed for CSR graph.\n");
+        return NULL;
+    }
+
+    csr->nn = graph->V;
+    csr->directed = graph->type;
+    csr->off = (long *) calloc((size_t) graph->V + 1, sizeof(long));
+    if (!csr->off) {
+        fprintf(stderr, "Error: Memory allocation failed for CSR offsets.\n");
+        freeCsr(csr);
+        return NULL;
+    }
+
+    // Degrees first, then the arcs in adjacency list order
+    for (int u = 0; u < graph->V; u++) {
+        long deg = 0;
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) deg++;
+        csr->off[u + 1] = csr->off[u] + deg;
+    }
+
+    csr->na = csr->off[graph->V];
+    size_t na = csr->na > 0 ? (size_t) csr->na : 1;
+    csr->adj = (int *) malloc(na * sizeof(int));
+    csr->cost = (int *) malloc(na * sizeof(int));
+    if (!csr->adj || !csr->cost) {
+        fprintf(stderr, "Error: Memory allocation failed for CSR arcs.\n");
+        freeCsr(csr);
+        return NULL;
+    }
+
+    for (int u = 0; u < graph->V; u++) {
+        long k = csr->off[u];
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next, k++) {
+            csr->adj[k] = tmp->data.v;
+            csr->cost[k] = tmp->data.cost;
+        }
+    }
+
+    return csr;
+}
+
+/**
+ * Function that builds a flat array with every arc of the graph.
+ * @param graph - pointer to the graph
+ * @param count - output: number of arcs
+ * @return - the arc array, or NULL on error
+ */
+Edge *graphToEdges(Graph graph, long *count) {
+    if (!graph || !count) return NULL;
+
+    long arcs = 0;
+    for (int u = 0; u < graph->V; u++) {
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) arcs++;
+    }
+
+    Edge *edges = (Edge *) malloc((arcs > 0 ? arcs : 1) * sizeof(Edge));
+    if (!edges) {
+        fprintf(stderr, "Error: Memory allocation failed for edge array.\n");
+        return NULL;
+    }
+
+    long k = 0;
+    for (int u = 0; u < graph->V; u++) {
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next, k++) {
+            edges[k].u = u;
+            edges[k].v = tmp->data.v;
+            edges[k].cost = tmp->data.cost;
+        }
+    }
+
+    *count = arcs;
+    return edges;
+}
+
 /**
  * Function that frees the allocated memory for a graph.
  * @param graph - pointer to the graph
@@ -196,7 +489,7 @@ void printGraph(Graph graph) {
 void freeGraph(Graph graph) {
     if (!graph) return;
 
-    // Free memory for adjacency lists
+    // Free memory for adjacency lists; nodes of a batch go with their block
     if (graph->adjLists) {
         for (int i = 0; i < graph->V; i++) {
             graph->adjLists[i] = freeList(graph->adjLists[i]);
@@ -204,7 +497,11 @@ void freeGraph(Graph graph) {
         free(graph->adjLists);
     }
 
+    for (int s = 0; s < graph->numSlabs; s++) free(graph->slabs[s]);
+    free(graph->slabs);
+
     // Free memory for auxiliary vectors
+    freeEdgeIndex(graph->index);
     free(graph->visited);
     free(graph->start);
     free(graph->end);
@@ -0,0 +1,124 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "include/graph.h"
+#include "include/edgeindex.h"
+
+/*
+ * Benchmarks getCost with every edge index kind against the plain list scan
+ * on random directed graphs. Half of the queried pairs are arcs. The matrix
+ * is only built for graphs small enough for EDGE_INDEX_MATRIX_MAX_V.
+ *
+ * Usage: idxbench [lookups=2000000]
+ */
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (unsigned) (rngState >> 32);
+}
+
+static double nowMs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static int runLookups(Graph graph, const int *qu, const int *qv, int lookups,
+                      long long *checksum) {
+    long long sum = 0;
+    double t0 = nowMs();
+    for (int i = 0; i < lookups; i++) {
+        sum += getCost(graph, qu[i], qv[i]);
+    }
+    double ms = nowMs() - t0;
+
+    *checksum = sum;
+    return (int) (ms * 1e6 / lookups); // ns per lookup
+}
+
+static int runGraph(int n, int degree, int lookups) {
+    Graph graph = initGraph(n, 1);
+    int *qu = malloc(lookups * sizeof(int));
+    int *qv = malloc(lookups * sizeof(int));
+    if (!graph || !qu || !qv) {
+        fprintf(stderr, "Error: Memory allocation failed for benchmark buffers.\n");
+        free(qu);
+        free(qv);
+        freeGraph(graph);
+        return 0;
+    }
+
+    for (int u = 0; u < n; u++) {
+        for (int e = 0; e < degree; e++) {
+            graph = insertEdge(graph, u, rng() % n, 1 + rng() % 100);
+        }
+    }
+
+    // Even queries hit an existing arc, odd ones are random pairs
+    for (int i = 0; i < lookups; i++) {
+        qu[i] = rng() % n;
+        if (i % 2 == 0) {
+            List tmp = graph->adjLists[qu[i]];
+            for (int skip = rng() % degree; skip > 0; skip--) tmp = tmp->next;
+            qv[i] = tmp->data.v;
+        } else {
+            qv[i] = rng() % n;
+        }
+    }
+
+    const char *names[] = {"list", "matrix", "sorted", "hash"};
+    EdgeIndexType types[] = {EDGE_INDEX_AUTO, EDGE_INDEX_MATRIX, EDGE_INDEX_SORTED, EDGE_INDEX_HASH};
+    EdgeIndexType pick = chooseEdgeIndex(n, (long) n * degree);
+    long long ref = 0, sum = 0;
+    int ok = 1;
+
+    printf("%7d %6d", n, degree);
+    for (int t = 0; t < 4; t++) {
+        if (types[t] == EDGE_INDEX_MATRIX && n > EDGE_INDEX_MATRIX_MAX_V) {
+            printf(" %8s", "-");
+            continue;
+        }
+
+        if (t > 0 && indexGraph(graph, types[t]) != 0) {
+            ok = 0;
+            continue;
+        }
+        int ns = runLookups(graph, qu, qv, lookups, t == 0 ? &ref : &sum);
+        if (t > 0 && sum != ref) ok = 0;
+        printf(" %8d", ns);
+    }
+    printf(" %8s %6s\n", names[pick], ok ? "yes" : "NO");
+
+    free(qu);
+    free(qv);
+    freeGraph(graph);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    int lookups = argc > 1 ? atoi(argv[1]) : 2000000;
+    if (lookups <= 0) {
+        fprintf(stderr, "Usage: %s [lookups]\n", argv[0]);
+        return 1;
+    }
+
+    printf("ns per getCost, %d lookups\n", lookups);
+    printf("%7s %6s %8s %8s %8s %8s %8s %6s\n", "V", "deg", "list", "matrix",
+           "sorted", "hash", "auto", "match");
+
+    int sizes[][2] = {{400, 50}, {4000, 400}, {200000, 8}, {20000, 128}};
+    int ok = 1;
+    for (int i = 0; i < 4; i++) {
+        ok &= runGraph(sizes[i][0], sizes[i][1], lookups);
+    }
+
+    printf(ok ? "costs match\n" : "costs DIFFER\n");
+    return ok ? 0 : 1;
+}
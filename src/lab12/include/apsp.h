@@ -0,0 +1,129 @@
+#ifndef __APSP_H__
+#define __APSP_H__
+
+#include "graph.h"
+
+/* ========================== CONSTANTS ========================== */
+
+/**
+ * Default tile size of the blocked Floyd-Warshall.
+ * - A 64x64 tile of `int` is 16 KB, so the three tiles touched by
+ *   one step fit together in a typical 32-48 KB L1 data cache.
+ */
+#define APSP_BLOCK 64
+
+/**
+ * Relative cost of one heap relaxation against one min-plus update.
+ * - `APSP_AUTO` runs V Dijkstras (Johnson) when
+ *   `APSP_DIJKSTRA_WEIGHT * E * log2(V) < V^2`, i.e. below an arc density
+ *   of about `1 / (APSP_DIJKSTRA_WEIGHT * log2(V))`.
+ * - Measured with `make fwbench` (vectorised Floyd-Warshall).
+ */
+#define APSP_DIJKSTRA_WEIGHT 25
+
+/**
+ * Algorithm used by `allPairsShortestPaths`.
+ */
+typedef enum {
+	APSP_AUTO,            /* choose by density */
+	APSP_FLOYD_WARSHALL,  /* blocked Floyd-Warshall, O(V^3) */
+	APSP_JOHNSON          /* reweighting + one Dijkstra per source */
+} ApspMethod;
+
+/* ========================== FUNCTION DECLARATIONS ========================== */
+
+/**
+ * Fills a **contiguous** `V x V` distance matrix with the edge costs of the graph.
+ * - Entry (`i`, `j`) is stored at `dist[i * V + j]`.
+ * - Missing edges (including the diagonal) are set to `INFINITY`.
+ * - For parallel edges the cheapest one is kept.
+ * 
+ * @param graph Pointer to the graph.
+ * @param dist Pre-allocated matrix of `V * V` integers.
+ */
+void fillDistanceMatrix(Graph graph, int *dist);
+
+/**
+ * Runs the classic **Floyd-Warshall** triple loop in place.
+ * - Kept as the reference implementation for the blocked version.
+ * 
+ * @param dist Contiguous `V x V` matrix initialised with edge costs.
+ * @param V Number of vertices.
+ */
+void floydWarshallNaive(int *dist, int V);
+
+/**
+ * Runs the **blocked (tiled) Floyd-Warshall** in place.
+ * - For every diagonal tile `kb` it first closes the tile itself, then the
+ *   tiles on row `kb` and column `kb`, and finally all remaining tiles.
+ * - The inner loop is a branch-free min-plus over a row, vectorised with SIMD.
+ * - The independent tiles of phases 2 and 3 are spread over OpenMP threads.
+ * - Produces the same matrix as `floydWarshallNaive`.
+ * 
+ * @param dist Contiguous `V x V` matrix initialised with edge costs.
+ * @param V Number of vertices.
+ * @param block Tile size (`APSP_BLOCK` if `<= 0`).
+ */
+void floydWarshallBlocked(int *dist, int V, int block);
+
+/**
+ * Computes all pairs shortest paths with **Johnson's algorithm**.
+ * - Bellman-Ford from a virtual source gives potentials `h` that make every
+ *   reduced cost `c + h[u] - h[v]` non-negative.
+ * - One lazy binary-heap Dijkstra per source, sources run in parallel.
+ * - Fills `dist` exactly like `fillDistanceMatrix` + Floyd-Warshall: entry
+ *   (`i`, `i`) is the cheapest cycle through `i`, `INFINITY` if none.
+ * 
+ * @param graph Pointer to the graph.
+ * @param dist Pre-allocated matrix of `V * V` integers.
+ * @return `0` on success, `-1` on a negative cycle or allocation failure
+ *         (`dist` is then left undefined).
+ */
+int johnsonAllPairs(Graph graph, int *dist);
+
+/**
+ * Picks the cheaper all-pairs algorithm for a graph of the given size.
+ * 
+ * @param V Number of vertices.
+ * @param E Number of arcs.
+ * @return `APSP_JOHNSON` for sparse graphs, `APSP_FLOYD_WARSHALL` otherwise.
+ */
+ApspMethod chooseApspMethod(int V, long E);
+
+/**
+ * Computes all pairs shortest paths into a contiguous `V x V` matrix.
+ * - `APSP_AUTO` decides with `chooseApspMethod`.
+ * - Johnson falls back to Floyd-Warshall on negative cycles.
+ * 
+ * @param graph Pointer to the graph.
+ * @param dist Pre-allocated matrix of `V * V` integers.
+ * @param method Algorithm to use.
+ * @return The algorithm that produced `dist`.
+ */
+ApspMethod allPairsShortestPaths(Graph graph, int *dist, ApspMethod method);
+
+/**
+ * Updates an all-pairs matrix after the arc (`u`, `v`) got cost `cost`
+ * (a new arc, or a cheaper cost for an existing one).
+ * - Every improved path uses the new arc: `d[i][j] = min(d[i][j],
+ *   d[i][u] + cost + d[v][j])`, where the walk to `u` / from `v` may be empty.
+ * - Only rows `i` with `d[i][u] + cost < d[i][v]` and columns `j` with
+ *   `cost + d[v][j] < d[u][j]` can change, so the work is O(V) plus the
+ *   affected rows times the affected columns, at most O(V^2).
+ * - For an undirected graph call it for (`u`, `v`) and (`v`, `u`).
+ * 
+ * @param dist Contiguous `V x V` matrix of shortest paths, as produced by
+ *        `allPairsShortestPaths` before the change.
+ * @param V Number of vertices.
+ * @param u Start vertex of the arc.
+ * @param v End vertex of the arc.
+ * @param cost New cost of the arc.
+ * @return Number of entries that changed, `-1` if the arc closes a
+ *         negative cycle, or `-2` on invalid arguments or a failed
+ *         allocation (`dist` is left unchanged in both cases).
+ */
+long updateAllPairsArc(int *dist, int V, int u, int v, int cost);
+
+/* ========================================================================== */
+
+#endif /* __APSP_H__ */
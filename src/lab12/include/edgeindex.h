@@ -0,0 +1,112 @@
+#ifndef __EDGEINDEX_H__
+#define __EDGEINDEX_H__
+
+#include <stddef.h>
+
+#include "graph.h"
+
+/* ========================== CONSTANTS ========================== */
+
+/* Graphs with at most this many vertices always get a dense matrix (1 MB). */
+#define EDGE_INDEX_SMALL_V 512
+
+/* Largest V for a dense matrix on dense graphs (64 MB of costs). */
+#define EDGE_INDEX_MATRIX_MAX_V 4096
+
+/* Arc density `E / V^2` from which the dense matrix is used. */
+#define EDGE_INDEX_DENSE 0.0625
+
+/* Average out-degree from which the hash beats binary search. */
+#define EDGE_INDEX_HASH_DEGREE 32
+
+/* ========================== STRUCTURES ========================== */
+
+/**
+ * Kind of edge lookup index.
+ */
+typedef enum {
+	EDGE_INDEX_AUTO,    /* choose by size and density */
+	EDGE_INDEX_MATRIX,  /* presence bitmatrix + V x V costs, O(1) */
+	EDGE_INDEX_SORTED,  /* per-vertex sorted neighbour arrays, O(log deg) */
+	EDGE_INDEX_HASH     /* global open-addressing hash on (u, v), O(1) expected */
+} EdgeIndexType;
+
+/**
+ * Structure representing an **edge lookup index** over a `Graph`.
+ * - For parallel arcs the index keeps the first one of the adjacency list,
+ *   like the linear scan of `getCost` does.
+ * - Only the fields of the chosen `type` are allocated.
+ */
+typedef struct edgeIndex {
+	EdgeIndexType type;
+	int V;
+
+	/* EDGE_INDEX_MATRIX */
+	unsigned long long *bits;  /* V x V presence bits, row-major */
+	int *matrix;               /* V x V costs */
+
+	/* EDGE_INDEX_SORTED */
+	long *off;                 /* V + 1 offsets into adj / cost */
+	int *adj;                  /* neighbours of every vertex, ascending */
+	int *cost;
+
+	/* EDGE_INDEX_HASH */
+	unsigned long long *keys;  /* (u << 32 | v), all bits set if the slot is free */
+	int *values;
+	int shift;                 /* 64 - log2(capacity) */
+} EdgeIndex;
+
+/* ========================== FUNCTION DECLARATIONS ========================== */
+
+/**
+ * Picks the index kind for a graph.
+ * - Dense matrix for small graphs (`V <= EDGE_INDEX_SMALL_V`) or dense ones.
+ * - Hash when the average out-degree reaches `EDGE_INDEX_HASH_DEGREE`.
+ * - Sorted neighbour arrays otherwise (compact, a few probes per lookup).
+ * 
+ * @param V Number of vertices.
+ * @param E Number of arcs.
+ * @return The chosen index kind (never `EDGE_INDEX_AUTO`).
+ */
+EdgeIndexType chooseEdgeIndex(int V, long E);
+
+/**
+ * Builds an **edge lookup index** over the current arcs of the graph.
+ * 
+ * @param graph Pointer to the graph.
+ * @param type Kind of index, `EDGE_INDEX_AUTO` to use `chooseEdgeIndex`.
+ * @return Pointer to the index, or `NULL` on error.
+ */
+EdgeIndex *buildEdgeIndex(Graph graph, EdgeIndexType type);
+
+/**
+ * Looks up the arc (`u`, `v`) in the index.
+ * 
+ * @param index Pointer to the index.
+ * @param u Start vertex.
+ * @param v End vertex.
+ * @param cost Output: cost of the arc, if found (may be `NULL`).
+ * @return `1` if the arc exists, `0` otherwise.
+ */
+int findEdgeIndex(const EdgeIndex *index, int u, int v, int *cost);
+
+/**
+ * Frees an edge lookup index.
+ * 
+ * @param index Pointer to the index.
+ */
+void freeEdgeIndex(EdgeIndex *index);
+
+/**
+ * Attaches a fresh edge index to the graph, replacing the previous one.
+ * - `getCost` and `isArc` use it until the next `insertEdge`, which drops it.
+ * 
+ * @param graph Pointer to the graph.
+ * @param type Kind of index, `EDGE_INDEX_AUTO` to choose by density.
+ * @return `0` on success, `-1` on error (the graph is then left unindexed).
+ */
+int indexGraph(Graph graph, EdgeIndexType type);
+
+/* ========================================================================== */
+
+#endif /* __EDGEINDEX_H__ */
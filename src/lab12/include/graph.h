@@ -5,9 +5,13 @@
 #include <stdlib.h>
 
 #include "list.h"
+#include "../../common/include/csr.h"
 
 #define INFINITY 999999
 
+/* Batches of at least this many edges are counted and placed in parallel. */
+#define BATCH_PARALLEL_MIN 65536
+
 /* ========================== STRUCTURES ========================== */
 
 /**
@@ -17,6 +21,10 @@
  * - `adjLists`: Adjacency list representation.
  * - `visited`: Array to track visited nodes.
  * - `start`, `end`: Arrays for time discovery (used in DFS).
+ * - `index`: Optional edge lookup index (see `edgeindex.h`), `NULL` if none.
+ * - `slabs`, `numSlabs`: Node blocks allocated by `insertEdges`, one per
+ *   batch. Their nodes are marked `pooled`, so lists can still be edited node
+ *   by node; the memory is released with the block in `freeGraph`.
  */
 typedef struct graph {
 	int V;
@@ -25,6 +33,9 @@ typedef struct graph {
 	int *visited;
 	int *start;
 	int *end;
+	struct edgeIndex *index;
+	List *slabs;
+	int numSlabs;
 } *Graph;
 
 /**
@@ -51,6 +62,7 @@ Graph initGraph(int V, int type);
  * Adds an **edge** between `u` and `v` with weight `cost`.
  * - If the graph is **not weighted**, set `cost = 0`.
  * - If the graph is **undirected**, also adds edge (`v`, `u`).
+ * - Drops the edge index of the graph, if any.
  * 
  * @param graph Pointer to the graph.
  * @param u Start vertex.
@@ -60,6 +72,34 @@ Graph initGraph(int V, int type);
  */
 Graph insertEdge(Graph graph, int u, int v, int cost);
 
+/**
+ * Adds a **batch of edges** in one pass.
+ * - Counting sort by source: the new nodes of every vertex are allocated as
+ *   one contiguous block and linked in place, instead of one `malloc` and a
+ *   list walk per edge.
+ * - The resulting lists are identical to calling `insertEdge` for every edge
+ *   in order (including both directions of undirected edges).
+ * - Batches of at least `BATCH_PARALLEL_MIN` edges are counted and placed
+ *   with OpenMP; the order stays the same.
+ * - Edges with invalid endpoints are skipped. Drops the edge index, if any.
+ * 
+ * @param graph Pointer to the graph.
+ * @param edges Array of edges.
+ * @param count Number of edges.
+ * @return The updated graph.
+ */
+Graph insertEdges(Graph graph, const Edge *edges, long count);
+
+/**
+ * Builds a graph from a **shared edge list** (see `../common/include/graphio.h`).
+ * - Directed lists give a directed graph (`type = 1`), others an undirected one.
+ * - All edges go in with one `insertEdges` batch; cost 0 for unweighted lists.
+ * 
+ * @param el Edge list.
+ * @return A pointer to the graph, or `NULL` on error.
+ */
+Graph graphFromEdgeList(const EdgeList *el);
+
 /**
  * Prints the adjacency list representation of the graph.
  * 
@@ -77,6 +117,7 @@ void drawGraph(Graph graph, const char *name);
 
 /**
  * Checks if there is an **edge** between `u` and `v`.
+ * - O(1) or O(log deg) with an edge index (`indexGraph`), a list scan otherwise.
  * 
  * @param graph Pointer to the graph.
  * @param u Start vertex.
@@ -88,6 +129,7 @@ int isArc(Graph graph, int u, int v);
 /**
  * Retrieves the **cost** of the edge (`u`, `v`).
  * - Returns `INFINITY` if `u` and `v` are **not connected**.
+ * - O(1) or O(log deg) with an edge index (`indexGraph`), a list scan otherwise.
  * 
  * @param graph Pointer to the graph.
  * @param u Start vertex.
@@ -96,6 +138,27 @@ int isArc(Graph graph, int u, int v);
  */
 int getCost(Graph graph, int u, int v);
 
+/**
+ * Builds a **CSR** copy of the graph (see `../common/include/csr.h`).
+ * - Arcs of each vertex keep the order of the adjacency list.
+ * - The adjacency lists are not modified; free the copy with `freeCsr`.
+ * 
+ * @param graph Pointer to the graph.
+ * @return Pointer to the CSR graph, or `NULL` on error.
+ */
+CsrGraph *graphToCsr(Graph graph);
+
+/**
+ * Builds a **flat edge array** with one `Edge` per stored arc.
+ * - Arcs are grouped by source vertex, in adjacency list order.
+ * - Undirected edges appear once in each direction.
+ * 
+ * @param graph Pointer to the graph.
+ * @param count Output: number of arcs in the array.
+ * @return Array of arcs (free with `free`), or `NULL` on error.
+ */
+Edge *graphToEdges(Graph graph, long *count);
+
 /**
  * Frees all **memory** allocated for the graph.
  * 
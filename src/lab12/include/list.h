@@ -20,13 +20,16 @@ typedef Pair V;
 
 /**
  * Structure representing a **doubly linked list node**.
- * - `data` : Stores the pair (vertex, cost).
- * - `prev` : Pointer to the previous node.
- * - `next` : Pointer to the next node.
+ * - `data`   : Stores the pair (vertex, cost).
+ * - `prev`   : Pointer to the previous node.
+ * - `next`   : Pointer to the next node.
+ * - `pooled` : The node lives in a block owned by someone else (see
+ *              `insertEdges`); unlinking it never frees it.
  */
 typedef struct list {
 	V data;
 	struct list *prev, *next;
+	bool pooled;
 } *List;
 
 /* ========================== FUNCTION DECLARATIONS ========================== */
@@ -56,6 +59,7 @@ List addLast(List list, V data);
 
 /**
  * Deletes the **first occurrence** of `data` from the list.
+ * Pooled nodes are only unlinked.
  * @param list Pointer to the existing list.
  * @param data Value to be removed.
  * @return Updated list pointer after deletion.
@@ -63,7 +67,7 @@ List addLast(List list, V data);
 List deleteItem(List list, V data);
 
 /**
- * Frees all **memory allocated** for the list.
+ * Frees all **memory allocated** for the list (pooled nodes excepted).
  * @param list Pointer to the existing list.
  * @return NULL after freeing all elements.
  */
@@ -0,0 +1,38 @@
+#ifndef __SCC_H__
+#define __SCC_H__
+
+#include "graph.h"
+
+/* ========================== FUNCTION DECLARATIONS ========================== */
+
+/**
+ * Finds the **strongly connected components** with Tarjan's algorithm.
+ * - Iterative DFS over a CSR copy of the graph with an explicit call stack,
+ *   so million-vertex paths do not overflow the C stack.
+ * - Fills `graph->start` / `graph->end` with the DFS discovery / finish
+ *   times (one shared clock, as in a classic DFS).
+ * - Components are numbered in **topological order** of the condensation:
+ *   every arc goes from a component to itself or to a higher id.
+ * 
+ * @param graph Pointer to the graph.
+ * @param comp Pre-allocated array of `V` integers for the component ids.
+ * @return Number of components, or `-1` on error.
+ */
+int stronglyConnectedComponents(Graph graph, int *comp);
+
+/**
+ * Builds the **condensation DAG** of a graph.
+ * - One vertex per component, one arc per pair of components joined by at
+ *   least one arc, with the cheapest cost among those arcs.
+ * - The arcs of every component are sorted by target id.
+ * 
+ * @param graph Pointer to the graph.
+ * @param comp Component ids from `stronglyConnectedComponents`.
+ * @param count Number of components.
+ * @return The condensation as a directed `Graph`, or `NULL` on error.
+ */
+Graph condensationGraph(Graph graph, const int *comp, int count);
+
+/* ========================================================================== */
+
+#endif /* __SCC_H__ */
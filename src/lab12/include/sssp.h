@@ -0,0 +1,99 @@
+#ifndef __SSSP_H__
+#define __SSSP_H__
+
+#include "graph.h"
+
+/* ========================== CONSTANTS ========================== */
+
+/**
+ * Number of rounds between two predecessor-cycle checks in
+ * `bellmanFordParallel`; the O(V) check is serial.
+ */
+#define SSSP_CYCLE_CHECK 8
+
+/* ========================== STRUCTURES ========================== */
+
+/**
+ * Result of a single-source shortest path run.
+ */
+typedef enum {
+	SSSP_ERROR = -1,          /* invalid input or allocation failure */
+	SSSP_OK = 0,              /* `distances` holds the shortest distances */
+	SSSP_NEGATIVE_CYCLE = 1   /* a negative cycle is reachable from the source */
+} SsspStatus;
+
+/* ========================== FUNCTION DECLARATIONS ========================== */
+
+/**
+ * Round-based **Bellman-Ford** with early termination.
+ * - Every round relaxes all arcs; stops after the first round without changes.
+ * - Reports a reachable **negative cycle** as soon as the predecessor graph
+ *   has a cycle (checked after every round), or at the latest when round
+ *   `V` still changes something.
+ * - Unreachable vertices get `INFINITY`.
+ * 
+ * @param graph Pointer to the graph.
+ * @param start Source vertex.
+ * @param distances Pre-allocated array of `V` integers.
+ * @return `SSSP_OK`, `SSSP_NEGATIVE_CYCLE` or `SSSP_ERROR`.
+ */
+SsspStatus bellmanFordRounds(Graph graph, int start, int *distances);
+
+/**
+ * Queue-based **Bellman-Ford** (SPFA).
+ * - A FIFO ring buffer holds the vertices whose distance changed; only their
+ *   arcs are relaxed, and each vertex is queued at most once at a time.
+ * - Detects a reachable **negative cycle** by checking the predecessor graph
+ *   for a cycle every `V` relaxations, and by counting the arcs of every
+ *   tentative path (a path with `V` arcs must repeat a vertex).
+ * - Unreachable vertices get `INFINITY`.
+ * 
+ * @param graph Pointer to the graph.
+ * @param start Source vertex.
+ * @param distances Pre-allocated array of `V` integers.
+ * @return `SSSP_OK`, `SSSP_NEGATIVE_CYCLE` or `SSSP_ERROR`.
+ */
+SsspStatus bellmanFordQueue(Graph graph, int start, int *distances);
+
+/**
+ * Parallel **Bellman-Ford** over a flat edge array (see `graphToEdges`).
+ * - Jacobi rounds: every round reads the distances of the previous round and
+ *   writes a second buffer, with the arcs split across OpenMP threads.
+ * - Concurrent writes use an atomic min on the pair (distance, predecessor),
+ *   so distances, predecessors and the number of rounds do not depend on the
+ *   thread count or the schedule.
+ * - Stops after the first round without changes; a **negative cycle** is
+ *   reported when the predecessor graph has a cycle (checked every
+ *   `SSSP_CYCLE_CHECK` rounds) or round `V` still changes something.
+ * 
+ * @param graph Pointer to the graph.
+ * @param start Source vertex.
+ * @param distances Pre-allocated array of `V` integers.
+ * @return `SSSP_OK`, `SSSP_NEGATIVE_CYCLE` or `SSSP_ERROR`.
+ */
+SsspStatus bellmanFordParallel(Graph graph, int start, int *distances);
+
+/**
+ * Updates single-source distances after the arc (`u`, `v`) got cost `cost`.
+ * - Call it after `insertEdge(graph, u, v, cost)`; inserting a cheaper
+ *   parallel arc is how a cost decrease is expressed.
+ * - Only vertices whose distance improves are visited: a FIFO queue starts
+ *   at `v` and follows arcs while distances keep dropping.
+ * - Any improvement of `u` itself means the arc closed a **negative cycle**.
+ * - Undirected graphs are handled in both directions.
+ * 
+ * @param graph Pointer to the graph, already containing the arc.
+ * @param start Source vertex `distances` was computed from.
+ * @param distances Shortest distances from `start` before the change.
+ * @param u Start vertex of the arc.
+ * @param v End vertex of the arc.
+ * @param cost Cost of the arc.
+ * @return `SSSP_OK`, `SSSP_NEGATIVE_CYCLE` (distances are then partial) or
+ *         `SSSP_ERROR`.
+ */
+SsspStatus updateSingleSourceArc(Graph graph, int start, int *distances,
+                                 int u, int v, int cost);
+
+/* ========================================================================== */
+
+#endif /* __SSSP_H__ */
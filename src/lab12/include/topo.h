@@ -0,0 +1,42 @@
+#ifndef __TOPO_H__
+#define __TOPO_H__
+
+#include "graph.h"
+
+/* ========================== FUNCTION DECLARATIONS ========================== */
+
+/**
+ * **Topological sort** with Kahn's algorithm.
+ * - Repeatedly removes a vertex of in-degree 0 (FIFO order), working on a
+ *   private in-degree array; the graph (including `visited`) is not
+ *   modified, so the function can be called any number of times.
+ * - Detects **cycles**: if some vertices never reach in-degree 0, `order`
+ *   holds only the vertices that could be sorted.
+ * - Undirected graphs with at least one edge are cyclic.
+ * 
+ * @param graph Pointer to the graph.
+ * @param order Pre-allocated array of `V` integers for the sorted vertices.
+ * @return `0` on success, `-1` if the graph has a cycle or on error.
+ */
+int topologicalSortKahn(Graph graph, int *order);
+
+/**
+ * **Level-wise topological sort**.
+ * - Level 0 holds the sources; a vertex is on level `l + 1` when its deepest
+ *   predecessor is on level `l` (longest path from a source).
+ * - Vertices of the same level do not depend on each other, so a scheduler
+ *   can run each level in parallel. The vertices of level `l` are
+ *   `order[levelStart[l] .. levelStart[l + 1])`, sorted by id.
+ * - Each frontier is expanded in parallel with OpenMP.
+ * - Re-entrant and cycle-detecting like `topologicalSortKahn`.
+ * 
+ * @param graph Pointer to the graph.
+ * @param order Pre-allocated array of `V` integers for the sorted vertices.
+ * @param levelStart Pre-allocated array of `V + 1` integers for level offsets.
+ * @return Number of levels, or `-1` if the graph has a cycle or on error.
+ */
+int topologicalLevels(Graph graph, int *order, int *levelStart);
+
+/* ========================================================================== */
+
+#endif /* __TOPO_H__ */
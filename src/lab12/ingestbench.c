@@ -0,0 +1,118 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "include/graph.h"
+
+/*
+ * Compares building a graph with one insertEdge call per edge against a single
+ * insertEdges batch. Random edges are loaded into a directed and an
+ * undirected graph; the batch graph also gets a few insertEdge calls before
+ * and after the batch, mirrored on the reference graph, so appending to
+ * existing lists is covered too.
+ * The adjacency lists of both graphs must be identical node for node.
+ *
+ * Usage: ingestbench [V=1000000] [E=4000000]
+ */
+
+#define MIXED_EDGES 1000
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (unsigned) (rngState >> 32);
+}
+
+static double nowMs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static int sameLists(Graph a, Graph b) {
+    for (int u = 0; u < a->V; u++) {
+        List x = a->adjLists[u], y = b->adjLists[u];
+        while (x && y) {
+            if (x->data.v != y->data.v || x->data.cost != y->data.cost) return 0;
+            if (x->next && x->next->prev != x) return 0;
+            x = x->next;
+            y = y->next;
+        }
+        if (x || y) return 0;
+    }
+    return 1;
+}
+
+static int runCase(int n, long m, const Edge *edges, int type) {
+    Graph ref = initGraph(n, type);
+    Graph batch = initGraph(n, type);
+    if (!ref || !batch) return 0;
+
+    // Edges inserted one by one into both graphs before and after the batch
+    Edge mixed[2 * MIXED_EDGES];
+    for (int i = 0; i < 2 * MIXED_EDGES; i++) {
+        mixed[i].u = rng() % n;
+        mixed[i].v = rng() % n;
+        mixed[i].cost = rng() % 100;
+    }
+
+    for (int i = 0; i < MIXED_EDGES; i++) insertEdge(ref, mixed[i].u, mixed[i].v, mixed[i].cost);
+    for (int i = 0; i < MIXED_EDGES; i++) insertEdge(batch, mixed[i].u, mixed[i].v, mixed[i].cost);
+
+    double t0 = nowMs();
+    for (long i = 0; i < m; i++) insertEdge(ref, edges[i].u, edges[i].v, edges[i].cost);
+    double tLoop = nowMs() - t0;
+
+    t0 = nowMs();
+    insertEdges(batch, edges, m);
+    double tBatch = nowMs() - t0;
+
+    for (int i = MIXED_EDGES; i < 2 * MIXED_EDGES; i++) {
+        insertEdge(ref, mixed[i].u, mixed[i].v, mixed[i].cost);
+        insertEdge(batch, mixed[i].u, mixed[i].v, mixed[i].cost);
+    }
+
+    int ok = sameLists(ref, batch);
+    printf("%-11s %12.1f %12.1f %9.2fx %10.1f   %s\n", type == 0 ? "undirected" : "directed",
+           tLoop, tBatch, tLoop / tBatch, m / (tBatch * 1e3), ok ? "same" : "DIFFERENT");
+
+    freeGraph(ref);
+    freeGraph(batch);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    long m = argc > 2 ? atol(argv[2]) : 4000000;
+    if (n <= 0 || m <= 0) {
+        fprintf(stderr, "Usage: %s [V] [E]\n", argv[0]);
+        return 1;
+    }
+
+    Edge *edges = malloc(m * sizeof(Edge));
+    if (!edges) {
+        fprintf(stderr, "Error: Memory allocation failed for edges.\n");
+        return 1;
+    }
+    for (long i = 0; i < m; i++) {
+        edges[i].u = rng() % n;
+        edges[i].v = rng() % n;
+        edges[i].cost = rng() % 100;
+    }
+
+    printf("V = %d, E = %ld\n", n, m);
+    printf("%-11s %12s %12s %10s %10s   %s\n", "graph", "loop (ms)", "batch (ms)", "speedup", "Medges/s", "lists");
+
+    int ok = runCase(n, m, edges, 1);
+    ok &= runCase(n, m, edges, 0);
+
+    free(edges);
+    printf(ok ? "batch and loop lists match\n" : "batch and loop lists DIFFER\n");
+    return ok ? 0 : 1;
+}
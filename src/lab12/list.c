@@ -14,6 +14,7 @@ List initList(V data)
     list->data = data;
     list->next = NULL;
     list->prev = NULL;
+    list->pooled = false;
     return list;
 }
 
@@ -60,7 +61,7 @@ List deleteItem(List list, V data) {
     if (temp->data.v == data.v && temp->data.cost == data.cost) {
         list = temp->next;
         if (list) list->prev = NULL;
-        free(temp);
+        if (!temp->pooled) free(temp);
         return list;
     }
 
@@ -72,7 +73,7 @@ List deleteItem(List list, V data) {
     if (temp->prev) temp->prev->next = temp->next;
     if (temp->next) temp->next->prev = temp->prev;
 
-    free(temp);
+    if (!temp->pooled) free(temp);
     return list;
 }
 
@@ -84,7 +85,7 @@ List freeList(List list)
     while (list) {
         List temp = list;
         list = list->next;
-        free(temp);
+        if (!temp->pooled) free(temp);
     }
     return NULL;
 }
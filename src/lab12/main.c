@@ -3,7 +3,11 @@
 #include <stdio.h>
 
 #include "include/graph.h"
-#include "include/stack.h"
+#include "include/apsp.h"
+#include "include/edgeindex.h"
+#include "include/sssp.h"
+#include "include/topo.h"
+#include "../common/include/graphio.h"
 
 /**
  * Function that checks if two integer arrays are equal.
@@ -21,133 +25,85 @@ int check(int *v1, int *v2, int size) {
     return 1;
 }
 
-/**
- * Recursive DFS function used for topological sorting.
- * @param graph - The input graph
- * @param start - Starting node
- * @param stack - Stack used for storing sorted nodes
- * @return - Updated stack
- */
-Stack dfs(Graph graph, int start, Stack stack) {
-    List list = graph->adjLists[start];
-    graph->visited[start] = 1;
-
-    while (list) {
-        if (!graph->visited[list->data.v])
-            stack = dfs(graph, list->data.v, stack);
-        list = list->next;
-    }
-
-    stack = push(stack, start);
-    return stack;
-}
-
 /**
  * Function that performs topological sorting for a Directed Acyclic Graph (DAG).
+ * Uses Kahn's algorithm, so the graph is left untouched and cycles are detected.
  * @param graph - The input graph
  * @param result - Pre-allocated array where the sorted order will be stored
+ * @return - 0 on success, -1 if the graph has a cycle
  */
-void topologicalSort(Graph graph, int *result) {
-    Stack stack = NULL;
-
-    // Perform DFS on all unvisited nodes
-    for (int i = 0; i < graph->V; i++) {
-        if (!graph->visited[i]) {
-            stack = dfs(graph, i, stack);
-        }
-    }
-
-    // Pop elements from stack to get topological order
-    int i = 0;
-    while (!isEmptyStack(stack)) {
-        result[i++] = top(stack);
-        stack = pop(stack);
-    }
+int topologicalSort(Graph graph, int *result) {
+    return topologicalSortKahn(graph, result);
 }
 
 /**
  * Function that computes the shortest paths from a single source using Bellman-Ford algorithm.
+ * Uses the queue-based variant (SPFA), which only relaxes vertices whose distance changed.
  * @param graph - The input graph
  * @param start - The starting node
  * @param distances - Pre-allocated array where the shortest distances will be stored
  */
 void BellmanFord(Graph graph, int start, int *distances) {
-    int V = graph->V;
-    
-    // Initialize distances to all nodes
-    for (int i = 0; i < V; i++) {
-        distances[i] = getCost(graph, start, i);
-    }
-    distances[start] = 0;
-
-    // Relax edges (V - 1) times
-    for (int i = 0; i < V - 2; i++) {
-        for (int j = 0; j < V; j++) {
-            List list = graph->adjLists[j];
-            while (list) {
-                int u = j;
-                int v = list->data.v;
-                if (distances[u] != INFINITY && distances[v] > distances[u] + list->data.cost) {
-                    distances[v] = distances[u] + list->data.cost;
-                }
-                list = list->next;
-            }
-        }
+    if (bellmanFordQueue(graph, start, distances) == SSSP_NEGATIVE_CYCLE) {
+        fprintf(stderr, "Warning: Negative cycle reachable from node %d.\n", start);
     }
 }
 
 /**
- * Function that computes the shortest paths between all pairs using Floyd-Warshall algorithm.
+ * Function that computes the shortest paths between all pairs using Floyd-Warshall algorithm
+ * (or Johnson's algorithm on sparse graphs, which yields the same matrix).
  * @param graph - The input graph
- * @param distances - Pre-allocated 2D array where the shortest distances will be stored
+ * @param distances - Pre-allocated V x V matrix (row-major) where the shortest distances will be stored
  */
-void FloydWarshall(Graph graph, int **distances) {
-    int V = graph->V;
-
-    // Initialize distance matrix
-    for (int i = 0; i < V; i++) {
-        for (int j = 0; j < V; j++) {
-            distances[i][j] = getCost(graph, i, j);
-        }
-    }
-
-    // Floyd-Warshall Algorithm
-    for (int k = 0; k < V; k++) {
-        for (int i = 0; i < V; i++) {
-            for (int j = 0; j < V; j++) {
-                int cost = getCost(graph, i, k);
-                if (cost == INFINITY || distances[k][j] == INFINITY) continue;
-                if (distances[i][j] > distances[k][j] + cost) {
-                    distances[i][j] = distances[k][j] + cost;
-                }
-            }
-        }
-    }
+void FloydWarshall(Graph graph, int *distances) {
+    allPairsShortestPaths(graph, distances, APSP_AUTO);
 }
 
-void executeTopologicalSort(Graph graph, int *expected, double *score) {
-    int *result = calloc(graph->V, sizeof(int));
-    if (!result) {
+void executeTopologicalSort(Graph graph, int *expected, int numExpected, double *score) {
+    int V = graph->V;
+    int *result = calloc(V, sizeof(int));
+    int *levelStart = calloc(V + 1, sizeof(int));
+    if (!result || !levelStart) {
         fprintf(stderr, "Error: Memory allocation failed for topological sort result.\n");
+        free(result);
+        free(levelStart);
         return;
     }
 
-    topologicalSort(graph, result);
+    int acyclic = topologicalSort(graph, result) == 0;
 
     printf("\nTopological Sort Result: ");
-    for (int i = 0; i < graph->V; i++) {
+    for (int i = 0; i < V; i++) {
         printf("%d ", result[i]);
     }
-    printf("\n");
+    printf(acyclic ? "\n" : "(cycle detected)\n");
+
+    // Several orders are valid; accept any of the expected ones
+    int correct = 0;
+    for (int k = 0; k < numExpected && acyclic && !correct; k++) {
+        correct = check(result, expected + k * V, V);
+    }
 
-    if (check(result, expected, graph->V)) {
+    if (correct) {
         printf("Correct\n");
         *score += 1.5;
     } else {
         printf("Incorrect\n");
     }
 
+    int levels = topologicalLevels(graph, result, levelStart);
+    printf("Topological Levels: ");
+    for (int l = 0; l < levels; l++) {
+        printf("{");
+        for (int i = levelStart[l]; i < levelStart[l + 1]; i++) {
+            printf(i + 1 < levelStart[l + 1] ? "%d " : "%d", result[i]);
+        }
+        printf("} ");
+    }
+    printf("\n");
+
     free(result);
+    free(levelStart);
 }
 
 void executeBellmanFord(Graph graph, int *expected, double *score) {
@@ -176,39 +132,31 @@ void executeBellmanFord(Graph graph, int *expected, double *score) {
 }
 
 void executeFloydWarshall(Graph graph, char *referenceFile, double *score) {
-    int **distances = malloc(graph->V * sizeof(int *));
+    int V = graph->V;
+    int *distances = malloc((size_t) V * V * sizeof(int));
     if (!distances) {
         fprintf(stderr, "Error: Memory allocation failed for Floyd-Warshall distance matrix.\n");
         return;
     }
 
-    for (int i = 0; i < graph->V; i++) {
-        distances[i] = calloc(graph->V, sizeof(int));
-        if (!distances[i]) {
-            fprintf(stderr, "Error: Memory allocation failed for Floyd-Warshall row.\n");
-            return;
-        }
-    }
-
     FloydWarshall(graph, distances);
 
     printf("\nFloyd-Warshall Result:\n");
     FILE *fin = fopen(referenceFile, "r");
     if (!fin) {
         fprintf(stderr, "Error: Unable to open reference file: %s\n", referenceFile);
+        free(distances);
         return;
     }
 
     int correct = 1, cost;
-    for (int i = 0; i < graph->V; i++) {
-        for (int j = 0; j < graph->V; j++) {
-            printf("%6d ", distances[i][j]);
-            fscanf(fin, "%d", &cost);
-            if (cost != distances[i][j]) {
+    for (int i = 0; i < V; i++) {
+        for (int j = 0; j < V; j++) {
+            printf("%6d ", distances[i * V + j]);
+            if (fscanf(fin, "%d", &cost) != 1 || cost != distances[i * V + j]) {
                 correct = 0;
             }
         }
-        free(distances[i]);
         printf("\n");
     }
 
@@ -223,33 +171,65 @@ void executeFloydWarshall(Graph graph, char *referenceFile, double *score) {
     }
 }
 
+/* Number of failed edge lookup checks, reported through the exit status. */
+static int lookupFailures = 0;
+
+/**
+ * Function that checks `isArc` and `getCost` for every pair of nodes against
+ * a plain walk of the adjacency lists.
+ * @param graph - The input graph
+ * @param label - Name of the lookup path being checked
+ */
+void executeEdgeLookup(Graph graph, const char *label) {
+    int correct = 1;
+    for (int u = 0; u < graph->V; u++) {
+        for (int v = 0; v < graph->V; v++) {
+            int cost = INFINITY;
+            for (List it = graph->adjLists[u]; it; it = it->next) {
+                if (it->data.v == v) {
+                    cost = it->data.cost;
+                    break;
+                }
+            }
+            if (isArc(graph, u, v) != (cost != INFINITY) || getCost(graph, u, v) != cost) {
+                correct = 0;
+            }
+        }
+    }
+
+    printf("Edge Lookup (%s): %s\n", label, correct ? "Correct" : "Incorrect");
+    if (!correct) lookupFailures++;
+}
+
 void processGraph(
 	char *inputFile, char *outputGraphFile, 
-	int *expectedTopoSort, int *expectedBellmanFord, char *fwRefFile, 
+	int *expectedTopoSort, int numTopoSorts, int *expectedBellmanFord, char *fwRefFile, 
 	double *score) 
 {
-    freopen(inputFile, "r", stdin);
-
-    int V, type, M, x, y, cost;
-    scanf("%d %d", &V, &type);
+    EdgeList *edges = loadEdgeList(inputFile, GRAPHIO_TYPED);
+    if (!edges) {
+        fprintf(stderr, "Error: Failed to load graph: %s\n", inputFile);
+        return;
+    }
 
-    Graph graph = initGraph(V, type);
+    Graph graph = graphFromEdgeList(edges);
+    freeEdgeList(edges);
     if (!graph) {
         fprintf(stderr, "Error: Failed to initialize graph.\n");
         return;
     }
 
-    scanf("%d", &M);
-    for (int i = 0; i < M; i++) {
-        scanf("%d %d %d", &x, &y, &cost);
-        graph = insertEdge(graph, x, y, cost);
-    }
+    executeEdgeLookup(graph, "lists");
+
+    // getCost / isArc lookups go through the index from now on
+    indexGraph(graph, EDGE_INDEX_AUTO);
+    executeEdgeLookup(graph, "index");
 
     printGraph(graph);
     drawGraph(graph, outputGraphFile);
 
     // Execute algorithms
-    executeTopologicalSort(graph, expectedTopoSort, score);
+    executeTopologicalSort(graph, expectedTopoSort, numTopoSorts, score);
     executeBellmanFord(graph, expectedBellmanFord, score);
     executeFloydWarshall(graph, fwRefFile, score);
 
@@ -266,7 +246,7 @@ int main() {
 
     printf("=============================================\n");
     printf("Processing test case: test0.in\n");
-    processGraph("../data/test0.in", "graph0.dot", top1, res1, "../data/test0.ref", &totalScore);
+    processGraph("../data/test0.in", "graph0.dot", top1, 1, res1, "../data/test0.ref", &totalScore);
 
     // Test case 2
     int top2[][7] = {
@@ -277,11 +257,11 @@ int main() {
 
     printf("=============================================\n");
     printf("Processing test case: test1.in\n");
-    processGraph("../data/test1.in", "graph1.dot", top2[0], res2, "../data/test1.ref", &totalScore);
+    processGraph("../data/test1.in", "graph1.dot", top2[0], 4, res2, "../data/test1.ref", &totalScore);
 
     printf("=============================================\n");
     printf("Total Score: %.2lf\n", totalScore);
     printf("Note: 1 bonus point is awarded if no memory leaks/errors occur.\n");
 
-    return 0;
+    return lookupFailures ? 1 : 0;
 }
\ No newline at end of file
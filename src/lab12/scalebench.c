@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "include/graph.h"
+#include "include/apsp.h"
+#include "include/sssp.h"
+#include "include/topo.h"
+#include "../common/include/benchrun.h"
+#include "../common/include/graphgen.h"
+
+/*
+ * Scale benchmark of BellmanFord (queue-based), FloydWarshall (blocked) and
+ * topologicalSort (Kahn) on synthetic directed graphs of doubling size,
+ * AVG_DEGREE arcs per vertex, costs in [1, MAX_COST]. Bellman-Ford and
+ * Floyd-Warshall run on every family (Erdos-Renyi, R-MAT, grid, DAG);
+ * Floyd-Warshall is O(V^3) with a V x V matrix, so it stops at FW_MAX_V.
+ * The topological sort only runs on the DAGs. Prints CSV (see benchrun.h)
+ * to stdout.
+ *
+ * Usage: scalebench [maxV=131072]
+ */
+
+#define MIN_V 1024
+#define FW_MAX_V 2048
+#define AVG_DEGREE 8
+#define MAX_COST 1000
+#define SEED 42
+
+typedef struct {
+    Graph graph;
+    int source;
+} ScaleCtx;
+
+static void runBellmanFord(void *ctx) {
+    ScaleCtx *sc = (ScaleCtx *) ctx;
+    int *dist = malloc(sc->graph->V * sizeof(int));
+    if (dist) bellmanFordQueue(sc->graph, sc->source, dist);
+    free(dist);
+}
+
+static void runFloydWarshall(void *ctx) {
+    ScaleCtx *sc = (ScaleCtx *) ctx;
+    int *dist = malloc((size_t) sc->graph->V * sc->graph->V * sizeof(int));
+    if (dist) allPairsShortestPaths(sc->graph, dist, APSP_FLOYD_WARSHALL);
+    free(dist);
+}
+
+static void runTopologicalSort(void *ctx) {
+    ScaleCtx *sc = (ScaleCtx *) ctx;
+    int *order = malloc(sc->graph->V * sizeof(int));
+    if (order) topologicalSortKahn(sc->graph, order);
+    free(order);
+}
+
+int main(int argc, char *argv[]) {
+    int maxV = argc > 1 ? atoi(argv[1]) : 131072;
+    if (maxV < MIN_V) {
+        fprintf(stderr, "Usage: %s [maxV >= %d]\n", argv[0], MIN_V);
+        return 1;
+    }
+
+    const GraphGenKind kinds[] = {GRAPHGEN_ERDOS_RENYI, GRAPHGEN_RMAT, GRAPHGEN_GRID, GRAPHGEN_DAG};
+    int failures = 0;
+
+    benchCsvHeader(stdout);
+    for (int k = 0; k < 4; k++) {
+        for (int n = MIN_V; n <= maxV; n *= 2) {
+            EdgeList *el = generateGraph(kinds[k], n, (long) n * AVG_DEGREE, 1, MAX_COST, SEED);
+            Graph graph = el ? graphFromEdgeList(el) : NULL;
+            if (!graph) {
+                fprintf(stderr, "Error: Failed to build benchmark graph.\n");
+                return 1;
+            }
+
+            ScaleCtx ctx = {graph, el->src[0]};
+            BenchCase bc = {"lab12", "BellmanFord", graphGenName(kinds[k]), el->nn, el->ne};
+            failures += benchRun(stdout, &bc, runBellmanFord, &ctx) != 0;
+
+            if (el->nn <= FW_MAX_V) {
+                bc.algorithm = "FloydWarshall";
+                failures += benchRun(stdout, &bc, runFloydWarshall, &ctx) != 0;
+            }
+
+            if (kinds[k] == GRAPHGEN_DAG) {
+                bc.algorithm = "topologicalSort";
+                failures += benchRun(stdout, &bc, runTopologicalSort, &ctx) != 0;
+            }
+
+            freeGraph(graph);
+            freeEdgeList(el);
+        }
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,183 @@
+#include "include/scc.h"
+
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Function that finds the strongly connected components with Tarjan's algorithm.
+ * @param graph - pointer to the graph
+ * @param comp - pre-allocated array of V component ids
+ * @return - number of components, or -1 on error
+ */
+int stronglyConnectedComponents(Graph graph, int *comp) {
+    if (!graph || !comp) return -1;
+
+    int n = graph->V;
+    CsrGraph *csr = graphToCsr(graph);
+    int *low = malloc(n * sizeof(int));
+    int *stack = malloc(n * sizeof(int));
+    int *callV = malloc(n * sizeof(int));
+    long *callK = malloc(n * sizeof(long));
+    char *onStack = calloc(n, sizeof(char));
+    if (!csr || !low || !stack || !callV || !callK || !onStack) {
+        fprintf(stderr, "Error: Memory allocation failed for SCC buffers.\n");
+        freeCsr(csr);
+        free(low);
+        free(stack);
+        free(callV);
+        free(callK);
+        free(onStack);
+        return -1;
+    }
+
+    int *disc = graph->start;
+    for (int v = 0; v < n; v++) {
+        disc[v] = -1;
+    }
+
+    int timer = 0, count = 0, top = 0;
+    for (int root = 0; root < n; root++) {
+        if (disc[root] != -1) continue;
+
+        // Explicit call stack: frame i is vertex callV[i], resuming at arc callK[i]
+        int depth = 1;
+        callV[0] = root;
+        callK[0] = csr->off[root];
+        disc[root] = low[root] = timer++;
+        stack[top++] = root;
+        onStack[root] = 1;
+
+        while (depth > 0) {
+            int u = callV[depth - 1];
+
+            if (callK[depth - 1] < csr->off[u + 1]) {
+                int w = csr->adj[callK[depth - 1]++];
+
+                if (disc[w] == -1) {
+                    disc[w] = low[w] = timer++;
+                    stack[top++] = w;
+                    onStack[w] = 1;
+                    callV[depth] = w;
+                    callK[depth] = csr->off[w];
+                    depth++;
+                } else if (onStack[w] && disc[w] < low[u]) {
+                    low[u] = disc[w];
+                }
+                continue;
+            }
+
+            // All arcs of u done: u roots a component if nothing below it
+            // reaches an older vertex still on the stack
+            graph->end[u] = timer++;
+            if (low[u] == disc[u]) {
+                int w;
+                do {
+                    w = stack[--top];
+                    onStack[w] = 0;
+                    comp[w] = count;
+                } while (w != u);
+                count++;
+            }
+
+            depth--;
+            if (depth > 0 && low[u] < low[callV[depth - 1]]) {
+                low[callV[depth - 1]] = low[u];
+            }
+        }
+    }
+
+    // Tarjan closes components in reverse topological order
+    for (int v = 0; v < n; v++) {
+        comp[v] = count - 1 - comp[v];
+    }
+
+    freeCsr(csr);
+    free(low);
+    free(stack);
+    free(callV);
+    free(callK);
+    free(onStack);
+    return count;
+}
+
+/**
+ * Function that builds the condensation DAG of a graph.
+ * @param graph - pointer to the graph
+ * @param comp - component id of every vertex
+ * @param count - number of components
+ * @return - the condensation graph, or NULL on error
+ */
+Graph condensationGraph(Graph graph, const int *comp, int count) {
+    if (!graph || !comp || count <= 0) return NULL;
+
+    int n = graph->V;
+    Graph dag = initGraph(count, 1);
+    int *first = calloc((size_t) count + 1, sizeof(int));
+    int *members = malloc(n * sizeof(int));
+    int *mark = malloc(count * sizeof(int));
+    int *best = malloc(count * sizeof(int));
+    int *targets = malloc(count * sizeof(int));
+    if (!dag || !first || !members || !mark || !best || !targets) {
+        fprintf(stderr, "Error: Memory allocation failed for condensation.\n");
+        freeGraph(dag);
+        free(first);
+        free(members);
+        free(mark);
+        free(best);
+        free(targets);
+        return NULL;
+    }
+
+    // Group the vertices by component (counting sort)
+    for (int v = 0; v < n; v++) {
+        first[comp[v] + 1]++;
+    }
+    for (int c = 0; c < count; c++) {
+        first[c + 1] += first[c];
+        mark[c] = -1;
+    }
+    for (int v = 0; v < n; v++) {
+        members[first[comp[v]]++] = v;
+    }
+    for (int c = count; c > 0; c--) {
+        first[c] = first[c - 1];
+    }
+    first[0] = 0;
+
+    for (int c = 0; c < count; c++) {
+        int numTargets = 0;
+
+        // mark[d] == c means d is already a target of c; keep the cheapest arc
+        for (int i = first[c]; i < first[c + 1]; i++) {
+            for (List tmp = graph->adjLists[members[i]]; tmp; tmp = tmp->next) {
+                int d = comp[tmp->data.v];
+                if (d == c) continue;
+
+                if (mark[d] != c) {
+                    mark[d] = c;
+                    best[d] = tmp->data.cost;
+                    targets[numTargets++] = d;
+                } else if (tmp->data.cost < best[d]) {
+                    best[d] = tmp->data.cost;
+                }
+            }
+        }
+
+        qsort(targets, numTargets, sizeof(int), compareInts);
+
+        // addFirst in reverse keeps the list ascending in O(1) per arc
+        for (int i = numTargets - 1; i >= 0; i--) {
+            Pair p = {targets[i], best[targets[i]]};
+            dag->adjLists[c] = addFirst(dag->adjLists[c], p);
+        }
+    }
+
+    free(first);
+    free(members);
+    free(mark);
+    free(best);
+    free(targets);
+    return dag;
+}
@@ -0,0 +1,247 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "include/graph.h"
+#include "include/scc.h"
+#include "include/topo.h"
+
+/*
+ * Benchmarks the iterative Tarjan SCC and the condensation on a large random
+ * digraph (average out-degree 2, so one giant component and many small ones)
+ * and on a single cycle through every vertex, which is as deep as a DFS gets.
+ * On a smaller graph the components are checked against the naive approach:
+ * for every unassigned vertex, intersect the sets reached forwards and
+ * backwards, O(components * E).
+ *
+ * Usage: sccbench [V=1000000] [naiveV=20000]
+ */
+
+#define OUT_DEGREE 2
+
+static unsigned long long rngState = 88172645463325252ULL;
+
+static unsigned rng(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (unsigned) (rngState >> 32);
+}
+
+static double nowMs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+static Graph randomGraph(int n) {
+    Graph graph = initGraph(n, 1);
+    for (int u = 0; graph && u < n; u++) {
+        for (int e = 0; e < OUT_DEGREE; e++) {
+            graph = insertEdge(graph, u, rng() % n, 1 + rng() % 100);
+        }
+    }
+    return graph;
+}
+
+static Graph cycleGraph(int n) {
+    Graph graph = initGraph(n, 1);
+    for (int u = 0; graph && u < n; u++) {
+        graph = insertEdge(graph, u, (u + 1) % n, 1);
+    }
+    return graph;
+}
+
+/**
+ * Function that labels components by intersecting forward and backward
+ * reachability; every component is named after its smallest vertex.
+ */
+static int naiveComponents(Graph graph, int *label) {
+    int n = graph->V;
+    long m = 0;
+    Edge *edges = graphToEdges(graph, &m);
+    long *roff = calloc((size_t) n + 1, sizeof(long));
+    int *radj = malloc((m > 0 ? m : 1) * sizeof(int));
+    int *queue = malloc(n * sizeof(int));
+    int *fwd = malloc(n * sizeof(int));
+    if (!edges || !roff || !radj || !queue || !fwd) {
+        free(edges);
+        free(roff);
+        free(radj);
+        free(queue);
+        free(fwd);
+        return -1;
+    }
+
+    // Reverse adjacency for the backward searches
+    for (long e = 0; e < m; e++) roff[edges[e].v + 1]++;
+    for (int v = 0; v < n; v++) roff[v + 1] += roff[v];
+    for (long e = 0; e < m; e++) radj[roff[edges[e].v]++] = edges[e].u;
+    for (int v = n; v > 0; v--) roff[v] = roff[v - 1];
+    roff[0] = 0;
+
+    int count = 0;
+    for (int v = 0; v < n; v++) {
+        label[v] = -1;
+        fwd[v] = -1;
+    }
+
+    for (int s = 0; s < n; s++) {
+        if (label[s] != -1) continue;
+
+        int head = 0, tail = 0;
+        queue[tail++] = s;
+        fwd[s] = s;
+        while (head < tail) {
+            int u = queue[head++];
+            for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+                if (fwd[tmp->data.v] != s) {
+                    fwd[tmp->data.v] = s;
+                    queue[tail++] = tmp->data.v;
+                }
+            }
+        }
+
+        // Backward search restricted to the forward set
+        head = tail = 0;
+        queue[tail++] = s;
+        label[s] = s;
+        while (head < tail) {
+            int u = queue[head++];
+            for (long k = roff[u]; k < roff[u + 1]; k++) {
+                int w = radj[k];
+                if (fwd[w] == s && label[w] == -1) {
+                    label[w] = s;
+                    queue[tail++] = w;
+                }
+            }
+        }
+        count++;
+    }
+
+    free(edges);
+    free(roff);
+    free(radj);
+    free(queue);
+    free(fwd);
+    return count;
+}
+
+/**
+ * Function that checks the condensation: a DAG whose arcs go to higher ids.
+ */
+static int validCondensation(Graph dag) {
+    int *order = malloc(dag->V * sizeof(int));
+    int ok = order && topologicalSortKahn(dag, order) == 0;
+    for (int c = 0; ok && c < dag->V; c++) {
+        for (List tmp = dag->adjLists[c]; tmp; tmp = tmp->next) {
+            if (tmp->data.v <= c) ok = 0;
+        }
+    }
+    free(order);
+    return ok;
+}
+
+static int runTarjan(const char *name, Graph graph) {
+    int *comp = malloc(graph->V * sizeof(int));
+    if (!comp) return 0;
+
+    double t0 = nowMs();
+    int count = stronglyConnectedComponents(graph, comp);
+    double sccMs = nowMs() - t0;
+
+    int *size = calloc(count > 0 ? count : 1, sizeof(int));
+    int largest = 0;
+    for (int v = 0; size && v < graph->V; v++) {
+        if (++size[comp[v]] > largest) largest = size[comp[v]];
+    }
+
+    t0 = nowMs();
+    Graph dag = condensationGraph(graph, comp, count);
+    double dagMs = nowMs() - t0;
+
+    long dagArcs = 0;
+    for (int c = 0; dag && c < dag->V; c++) {
+        for (List tmp = dag->adjLists[c]; tmp; tmp = tmp->next) dagArcs++;
+    }
+
+    int ok = count > 0 && dag && validCondensation(dag);
+    printf("%-8s %8d %10d %10d %9ld %10.1f %10.1f %5s\n", name, graph->V, count,
+           largest, dagArcs, sccMs, dagMs, ok ? "yes" : "NO");
+
+    freeGraph(dag);
+    free(size);
+    free(comp);
+    return ok;
+}
+
+static int runNaive(int n) {
+    Graph graph = randomGraph(n);
+    int *comp = malloc(n * sizeof(int));
+    int *label = malloc(n * sizeof(int));
+    int *name = malloc(n * sizeof(int));
+    if (!graph || !comp || !label || !name) {
+        free(comp);
+        free(label);
+        free(name);
+        freeGraph(graph);
+        return 0;
+    }
+
+    double t0 = nowMs();
+    int count = stronglyConnectedComponents(graph, comp);
+    double tarjanMs = nowMs() - t0;
+
+    t0 = nowMs();
+    int naiveCount = naiveComponents(graph, label);
+    double naiveMs = nowMs() - t0;
+
+    // Same partition: name Tarjan's components after their smallest vertex
+    for (int c = 0; c < count; c++) name[c] = -1;
+    for (int v = 0; v < n; v++) {
+        if (name[comp[v]] == -1) name[comp[v]] = v;
+    }
+    int ok = count == naiveCount;
+    for (int v = 0; ok && v < n; v++) {
+        if (name[comp[v]] != label[v]) ok = 0;
+    }
+
+    printf("naive check V=%d: %d components, tarjan %.1f ms, naive %.1f ms, %s\n",
+           n, count, tarjanMs, naiveMs, ok ? "same partition" : "DIFFERENT");
+
+    free(comp);
+    free(label);
+    free(name);
+    freeGraph(graph);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int naiveN = argc > 2 ? atoi(argv[2]) : 20000;
+    if (n <= 0 || naiveN <= 0) {
+        fprintf(stderr, "Usage: %s [V] [naiveV]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%-8s %8s %10s %10s %9s %10s %10s %5s\n", "graph", "V", "SCCs",
+           "largest", "DAG arcs", "tarjan ms", "dag ms", "DAG");
+
+    int ok = 1;
+    Graph graph = randomGraph(n);
+    if (!graph) return 1;
+    ok &= runTarjan("random", graph);
+    freeGraph(graph);
+
+    graph = cycleGraph(n);
+    if (!graph) return 1;
+    ok &= runTarjan("cycle", graph);
+    freeGraph(graph);
+
+    ok &= runNaive(naiveN);
+
+    printf(ok ? "components match\n" : "components DIFFER\n");
+    return ok ? 0 : 1;
+}
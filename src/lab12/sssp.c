@@ -0,0 +1,362 @@
+#include <string.h>
+
+#include "include/sssp.h"
+
+/* (distance, predecessor) pairs packed so that integer order is pair order */
+#define KEY_SHIFT 4294967296LL
+#define KEY_INF ((long long) INFINITY * KEY_SHIFT)
+
+static inline long long packKey(int dist, int pred) {
+    return (long long) dist * KEY_SHIFT + (unsigned) pred;
+}
+
+static inline int keyDist(long long key) {
+    // Floor division, the low half is always non-negative
+    return (int) ((key - (key & (KEY_SHIFT - 1))) / KEY_SHIFT);
+}
+
+static inline int keyPred(long long key) {
+    return (int) (key & (KEY_SHIFT - 1));
+}
+
+/**
+ * Function that lowers `*slot` to `key` atomically.
+ * @return - 1 if the slot was lowered, 0 if it already held a smaller key
+ */
+static inline int atomicMinKey(long long *slot, long long key) {
+    long long old = __atomic_load_n(slot, __ATOMIC_RELAXED);
+    while (key < old) {
+        if (__atomic_compare_exchange_n(slot, &old, key, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            return 1;
+    }
+    return 0;
+}
+
+/**
+ * Function that looks for a cycle in the predecessor graph.
+ * Every such cycle is a negative cycle of the input graph, and one appears
+ * long before a path reaches V arcs, so this detects cycles early.
+ * @param pred - predecessor of every vertex (-1 for none)
+ * @param n - number of vertices
+ * @param walk - scratch array of n integers
+ * @return - 1 if the predecessor graph has a cycle, 0 otherwise
+ */
+static int predecessorCycle(const int *pred, int n, int *walk) {
+    for (int v = 0; v < n; v++) {
+        walk[v] = -1;
+    }
+
+    // Follow predecessors from every vertex, tagging nodes with the walk id;
+    // meeting a node of the current walk again closes a cycle
+    for (int v = 0; v < n; v++) {
+        int u = v;
+        while (u != -1 && walk[u] == -1) {
+            walk[u] = v;
+            u = pred[u];
+        }
+        if (u != -1 && walk[u] == v) return 1;
+    }
+    return 0;
+}
+
+/**
+ * Function that runs Bellman-Ford in rounds until nothing changes.
+ * @param graph - pointer to the graph
+ * @param start - source vertex
+ * @param distances - pre-allocated array of V distances
+ * @return - SSSP_OK, SSSP_NEGATIVE_CYCLE or SSSP_ERROR
+ */
+SsspStatus bellmanFordRounds(Graph graph, int start, int *distances) {
+    if (!graph || !distances || start < 0 || start >= graph->V) return SSSP_ERROR;
+
+    int n = graph->V;
+    int *pred = malloc(n * sizeof(int));
+    int *walk = malloc(n * sizeof(int));
+    if (!pred || !walk) {
+        fprintf(stderr, "Error: Memory allocation failed for Bellman-Ford buffers.\n");
+        free(pred);
+        free(walk);
+        return SSSP_ERROR;
+    }
+
+    for (int v = 0; v < n; v++) {
+        distances[v] = INFINITY;
+        pred[v] = -1;
+    }
+    distances[start] = 0;
+
+    // Shortest paths have at most V - 1 arcs, so round V only changes
+    // something if a negative cycle is reachable
+    SsspStatus status = SSSP_NEGATIVE_CYCLE;
+    for (int round = 0; round < n; round++) {
+        int changed = 0;
+
+        for (int u = 0; u < n; u++) {
+            if (distances[u] == INFINITY) continue;
+
+            for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+                int cand = distances[u] + tmp->data.cost;
+                if (cand < distances[tmp->data.v]) {
+                    distances[tmp->data.v] = cand;
+                    pred[tmp->data.v] = u;
+                    changed = 1;
+                }
+            }
+        }
+
+        if (!changed) {
+            status = SSSP_OK;
+            break;
+        }
+        if (predecessorCycle(pred, n, walk)) break;
+    }
+
+    free(pred);
+    free(walk);
+    return status;
+}
+
+/**
+ * Function that runs the queue-based Bellman-Ford (SPFA).
+ * @param graph - pointer to the graph
+ * @param start - source vertex
+ * @param distances - pre-allocated array of V distances
+ * @return - SSSP_OK, SSSP_NEGATIVE_CYCLE or SSSP_ERROR
+ */
+SsspStatus bellmanFordQueue(Graph graph, int start, int *distances) {
+    if (!graph || !distances || start < 0 || start >= graph->V) return SSSP_ERROR;
+
+    int n = graph->V;
+    int *ring = malloc(n * sizeof(int));
+    int *arcs = malloc(n * sizeof(int));
+    int *pred = malloc(n * sizeof(int));
+    int *walk = malloc(n * sizeof(int));
+    char *queued = calloc(n, sizeof(char));
+    if (!ring || !arcs || !pred || !walk || !queued) {
+        fprintf(stderr, "Error: Memory allocation failed for SPFA buffers.\n");
+        free(ring);
+        free(arcs);
+        free(pred);
+        free(walk);
+        free(queued);
+        return SSSP_ERROR;
+    }
+
+    for (int v = 0; v < n; v++) {
+        distances[v] = INFINITY;
+        pred[v] = -1;
+    }
+    distances[start] = 0;
+    arcs[start] = 0;
+
+    // Each vertex is in the ring at most once, so V slots are enough
+    int head = 0, size = 1;
+    ring[0] = start;
+    queued[start] = 1;
+
+    SsspStatus status = SSSP_OK;
+    long relaxed = 0;
+    while (size > 0 && status == SSSP_OK) {
+        int u = ring[head];
+        head = head + 1 == n ? 0 : head + 1;
+        size--;
+        queued[u] = 0;
+
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+            int v = tmp->data.v;
+            int cand = distances[u] + tmp->data.cost;
+            if (cand >= distances[v]) continue;
+
+            distances[v] = cand;
+            pred[v] = u;
+            arcs[v] = arcs[u] + 1;
+
+            // The O(V) predecessor check every V relaxations is amortised O(1)
+            if (arcs[v] >= n || (++relaxed % n == 0 && predecessorCycle(pred, n, walk))) {
+                status = SSSP_NEGATIVE_CYCLE;
+                break;
+            }
+
+            if (!queued[v]) {
+                int tail = head + size < n ? head + size : head + size - n;
+                ring[tail] = v;
+                size++;
+                queued[v] = 1;
+            }
+        }
+    }
+
+    free(ring);
+    free(arcs);
+    free(pred);
+    free(walk);
+    free(queued);
+    return status;
+}
+
+/**
+ * Function that runs the parallel Jacobi Bellman-Ford over a flat edge array.
+ * @param graph - pointer to the graph
+ * @param start - source vertex
+ * @param distances - pre-allocated array of V distances
+ * @return - SSSP_OK, SSSP_NEGATIVE_CYCLE or SSSP_ERROR
+ */
+SsspStatus bellmanFordParallel(Graph graph, int start, int *distances) {
+    if (!graph || !distances || start < 0 || start >= graph->V) return SSSP_ERROR;
+
+    int n = graph->V;
+    long m = 0;
+    Edge *edges = graphToEdges(graph, &m);
+    long long *cur = malloc(n * sizeof(long long));
+    long long *next = malloc(n * sizeof(long long));
+    int *pred = malloc(n * sizeof(int));
+    int *walk = malloc(n * sizeof(int));
+    if (!edges || !cur || !next || !pred || !walk) {
+        fprintf(stderr, "Error: Memory allocation failed for parallel Bellman-Ford buffers.\n");
+        free(edges);
+        free(cur);
+        free(next);
+        free(pred);
+        free(walk);
+        return SSSP_ERROR;
+    }
+
+    // Predecessor n marks "none", it sorts after every real vertex
+    for (int v = 0; v < n; v++) {
+        cur[v] = packKey(INFINITY, n);
+    }
+    cur[start] = packKey(0, n);
+
+    SsspStatus status = SSSP_NEGATIVE_CYCLE;
+    for (int round = 0; round < n; round++) {
+        int changed = 0;
+        memcpy(next, cur, n * sizeof(long long));
+
+        #pragma omp parallel for schedule(static) reduction(|:changed)
+        for (long e = 0; e < m; e++) {
+            long long du = cur[edges[e].u];
+            if (du >= KEY_INF) continue;
+
+            // Only strict improvements over the previous round; the tie on
+            // the predecessor just makes the winner deterministic. Accepting
+            // equal distances could close zero-cost cycles of predecessors.
+            int cand = keyDist(du) + edges[e].cost;
+            if (cand >= keyDist(cur[edges[e].v])) continue;
+            if (atomicMinKey(&next[edges[e].v], packKey(cand, edges[e].u))) changed = 1;
+        }
+
+        long long *tmp = cur;
+        cur = next;
+        next = tmp;
+
+        if (!changed) {
+            status = SSSP_OK;
+            break;
+        }
+
+        if ((round + 1) % SSSP_CYCLE_CHECK == 0) {
+            for (int v = 0; v < n; v++) {
+                int p = keyPred(cur[v]);
+                pred[v] = p == n ? -1 : p;
+            }
+            if (predecessorCycle(pred, n, walk)) break;
+        }
+    }
+
+    for (int v = 0; v < n; v++) {
+        distances[v] = cur[v] >= KEY_INF ? INFINITY : keyDist(cur[v]);
+    }
+
+    free(edges);
+    free(cur);
+    free(next);
+    free(pred);
+    free(walk);
+    return status;
+}
+
+/**
+ * Function that propagates a distance decrease of `v` through the graph.
+ * @param graph - pointer to the graph
+ * @param distances - distances to update
+ * @param u - start vertex of the new arc, must not improve
+ * @param v - end vertex of the new arc
+ * @param cand - new distance candidate for v
+ * @param ring - scratch FIFO of V slots
+ * @param queued - scratch flags of V entries, all 0 (left all 0 on SSSP_OK)
+ * @return - SSSP_OK or SSSP_NEGATIVE_CYCLE
+ */
+static SsspStatus propagateDecrease(Graph graph, int *distances, int u, int v, int cand,
+                                    int *ring, char *queued) {
+    int n = graph->V;
+    if (cand >= distances[v]) return SSSP_OK;
+    if (v == u) return SSSP_NEGATIVE_CYCLE;
+
+    distances[v] = cand;
+    int head = 0, size = 1;
+    ring[0] = v;
+    queued[v] = 1;
+
+    while (size > 0) {
+        int x = ring[head];
+        head = head + 1 == n ? 0 : head + 1;
+        size--;
+        queued[x] = 0;
+
+        for (List tmp = graph->adjLists[x]; tmp; tmp = tmp->next) {
+            int w = tmp->data.v;
+            if (distances[x] + tmp->data.cost >= distances[w]) continue;
+
+            // Improving u goes around the new arc again
+            if (w == u) return SSSP_NEGATIVE_CYCLE;
+
+            distances[w] = distances[x] + tmp->data.cost;
+            if (!queued[w]) {
+                int tail = head + size < n ? head + size : head + size - n;
+                ring[tail] = w;
+                size++;
+                queued[w] = 1;
+            }
+        }
+    }
+
+    return SSSP_OK;
+}
+
+/**
+ * Function that updates single-source distances after an arc insertion or decrease.
+ * @param graph - pointer to the graph, already containing the arc
+ * @param start - source vertex
+ * @param distances - shortest distances from start before the change
+ * @param u - start vertex of the arc
+ * @param v - end vertex of the arc
+ * @param cost - cost of the arc
+ * @return - SSSP_OK, SSSP_NEGATIVE_CYCLE or SSSP_ERROR
+ */
+SsspStatus updateSingleSourceArc(Graph graph, int start, int *distances,
+                                 int u, int v, int cost) {
+    if (!graph || !distances || start < 0 || start >= graph->V ||
+        u < 0 || v < 0 || u >= graph->V || v >= graph->V) return SSSP_ERROR;
+
+    int n = graph->V;
+    int *ring = malloc(n * sizeof(int));
+    char *queued = calloc(n, sizeof(char));
+    if (!ring || !queued) {
+        fprintf(stderr, "Error: Memory allocation failed for SSSP update.\n");
+        free(ring);
+        free(queued);
+        return SSSP_ERROR;
+    }
+
+    SsspStatus status = SSSP_OK;
+    if (distances[u] != INFINITY) {
+        status = propagateDecrease(graph, distances, u, v, distances[u] + cost, ring, queued);
+    }
+    if (status == SSSP_OK && graph->type == 0 && distances[v] != INFINITY) {
+        status = propagateDecrease(graph, distances, v, u, distances[v] + cost, ring, queued);
+    }
+
+    free(ring);
+    free(queued);
+    return status;
+}
@@ -0,0 +1,106 @@
+#include "include/topo.h"
+
+/**
+ * Function that sorts the vertices topologically with Kahn's algorithm.
+ * @param graph - pointer to the graph
+ * @param order - pre-allocated array of V vertices
+ * @return - 0 on success, -1 if the graph has a cycle or on error
+ */
+int topologicalSortKahn(Graph graph, int *order) {
+    if (!graph || !order) return -1;
+
+    int n = graph->V;
+    int *inDegree = calloc(n, sizeof(int));
+    if (!inDegree) {
+        fprintf(stderr, "Error: Memory allocation failed for in-degree array.\n");
+        return -1;
+    }
+
+    for (int u = 0; u < n; u++) {
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+            inDegree[tmp->data.v]++;
+        }
+    }
+
+    // `order` doubles as the FIFO queue: [head, tail) are the queued
+    // vertices, everything before head is already sorted
+    int head = 0, tail = 0;
+    for (int v = 0; v < n; v++) {
+        if (inDegree[v] == 0) order[tail++] = v;
+    }
+
+    while (head < tail) {
+        int u = order[head++];
+        for (List tmp = graph->adjLists[u]; tmp; tmp = tmp->next) {
+            if (--inDegree[tmp->data.v] == 0) order[tail++] = tmp->data.v;
+        }
+    }
+
+    free(inDegree);
+    return tail == n ? 0 : -1;
+}
+
+static int compareInts(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Function that groups the vertices by topological level.
+ * @param graph - pointer to the graph
+ * @param order - pre-allocated array of V vertices
+ * @param levelStart - pre-allocated array of V + 1 level offsets
+ * @return - number of levels, or -1 if the graph has a cycle or on error
+ */
+int topologicalLevels(Graph graph, int *order, int *levelStart) {
+    if (!graph || !order || !levelStart) return -1;
+
+    CsrGraph *csr = graphToCsr(graph);
+    int n = graph->V;
+    int *inDegree = calloc(n, sizeof(int));
+    if (!csr || !inDegree) {
+        fprintf(stderr, "Error: Memory allocation failed for level sort.\n");
+        freeCsr(csr);
+        free(inDegree);
+        return -1;
+    }
+
+    #pragma omp parallel for schedule(static)
+    for (long k = 0; k < csr->na; k++) {
+        __atomic_fetch_add(&inDegree[csr->adj[k]], 1, __ATOMIC_RELAXED);
+    }
+
+    int tail = 0;
+    for (int v = 0; v < n; v++) {
+        if (inDegree[v] == 0) order[tail++] = v;
+    }
+
+    // The current level is order[head, tail); the next one is appended after
+    // it by the threads that drop the last in-degree of a vertex
+    int levels = 0, head = 0;
+    while (head < tail) {
+        levelStart[levels++] = head;
+        int next = tail;
+
+        #pragma omp parallel for schedule(dynamic, 64)
+        for (int i = head; i < tail; i++) {
+            int u = order[i];
+            for (long k = csr->off[u]; k < csr->off[u + 1]; k++) {
+                int v = csr->adj[k];
+                if (__atomic_sub_fetch(&inDegree[v], 1, __ATOMIC_ACQ_REL) == 0) {
+                    order[__atomic_fetch_add(&next, 1, __ATOMIC_RELAXED)] = v;
+                }
+            }
+        }
+
+        // Threads append in any order; sorting keeps the result deterministic
+        qsort(order + tail, next - tail, sizeof(int), compareInts);
+        head = tail;
+        tail = next;
+    }
+    levelStart[levels] = tail;
+
+    freeCsr(csr);
+    free(inDegree);
+    return tail == n ? levels : -1;
+}